@@ -1,24 +1,38 @@
 #include "AnimatedButton.h"
 #include "Utils.h"
 #include "Screen.h"
+#include "App.h"
 
 namespace
 {
-	const int TOTAL_ANIMATION_TIME = 1000;
+	const uint32_t TOTAL_ANIMATION_TIME = 1000;
     const bool BOUNCE_FULL_TEXT = true; //Section 3 - Exercise 3 - set to false
+
+	//Ignores the tween's progress, flashes on the clock
+	float HighPulse(float)
+	{
+		return Pulse(10);
+	}
 }
 
 
 AnimatedButton::AnimatedButton(const BitmapFont& bitmapFont, const Color& textColor, const Color& highlightColor /*= Color::White()*/)
 	:Button(bitmapFont, textColor, highlightColor)
 	, mOriginalColor(textColor)
-	, mTotalAnimationTime(TOTAL_ANIMATION_TIME)
-	, mAnimationTime(0)
-	, mIsAnimating(false)
+	, mBounceTween(INVALID_TWEEN_HANDLE)
+	, mExecuteTween(INVALID_TWEEN_HANDLE)
+	, mStartBounce(false)
 	, mExecuteTriggered(false)
 {
 }
 
+AnimatedButton::~AnimatedButton()
+{
+	TweenEngine& tweens = App::Singleton().GetTweenEngine();
+	tweens.Cancel(mBounceTween);
+	tweens.Cancel(mExecuteTween);
+}
+
 void AnimatedButton::Init(const std::string& text, Vec2D topLeft, unsigned int width, unsigned height)
 {
 	Button::Init(text, topLeft, width, height);
@@ -36,46 +50,31 @@ void AnimatedButton::Update(uint32_t dt)
 		mHighlightColor.SetAlpha( static_cast<uint8_t>(round(255.0 * Pulse(0.5))));
 	}
 
-	mDrawPosition = mBitmapFont.GetDrawPosition(mTitle, mBBox, BFXA_CENTER, BFYA_CENTER);
+	//Running tweens put their values back after this
+	mDrawPosition = mTextPosition;
 	mTextColor = mOriginalColor;
 
-	if (mIsAnimating && IsHighlighted() && !mExecuteTriggered)
+	TweenEngine& tweens = App::Singleton().GetTweenEngine();
+
+	if (mStartBounce && IsHighlighted() && !mExecuteTriggered)
 	{
-        float t = UpdateAnimationTime(dt);
-        
+		mStartBounce = false;
+
         if(BOUNCE_FULL_TEXT)
         {
-            const Vec2D endPosition = mBitmapFont.GetDrawPosition(mTitle, mBBox, BFXA_CENTER, BFYA_CENTER);
-            
-            mDrawPosition = Vec2D::Lerp(
-				Vec2D(mBBox.GetTopLeftPoint().GetX(), endPosition.GetY()),
-				endPosition,
-				t,
-				ease::EaseOutBounce);
+            const Vec2D endPosition = mTextPosition;
+
+			mBounceTween = tweens.Start(&mDrawPosition, Vec2D(mBBox.GetTopLeftPoint().GetX(), endPosition.GetY()), endPosition, TOTAL_ANIMATION_TIME, ease::EASE_OUT_BOUNCE);
         }
         else
         {
-            UpdateLetterAnimationData();
+			mBounceTween = tweens.StartTimer(TOTAL_ANIMATION_TIME, nullptr, nullptr);
         }
 	}
 
-	if (mExecuteTriggered)
+	if (!BOUNCE_FULL_TEXT && tweens.IsActive(mBounceTween))
 	{
-		float t = UpdateAnimationTime(dt);
-
-		if (IsGreaterThanOrEqual(t, 1.0f))
-		{
-			Button::ExecuteAction();
-			mExecuteTriggered = false;
-			return;
-		}
-
-		auto HighPulse = [](float) -> float
-		{
-			return Pulse(10);
-		};
-
-		mTextColor = Color::Lerp(mOriginalColor, Color::Orange(), t, HighPulse);
+		UpdateLetterAnimationData();
 	}
 }
 
@@ -93,35 +92,37 @@ void AnimatedButton::Draw(Screen& theScreen)
 
 void AnimatedButton::ExecuteAction()
 {
+	TweenEngine& tweens = App::Singleton().GetTweenEngine();
+
+	tweens.Cancel(mBounceTween);
+	tweens.Cancel(mExecuteTween);
+
 	mExecuteTriggered = true;
-	mIsAnimating = true;
-	mAnimationTime = 0;
+	mExecuteTween = tweens.Start(&mTextColor, mOriginalColor, Color::Orange(), TOTAL_ANIMATION_TIME, ease::EASE_LINEAR, OnExecuteAnimationFinished, this);
+	tweens.SetEasingFunc(mExecuteTween, HighPulse);
+
+	if (mExecuteTween == INVALID_TWEEN_HANDLE)
+	{
+		//No tween to wait for
+		OnExecuteAnimationFinished(this);
+	}
 }
 
 void AnimatedButton::SetHighlighted(bool highlighted)
 {
 	Button::SetHighlighted(highlighted);
-	mIsAnimating = true;
-	mAnimationTime = 0;
-}
 
+	App::Singleton().GetTweenEngine().Cancel(mBounceTween);
+	mStartBounce = highlighted;
+}
 
-float AnimatedButton::UpdateAnimationTime(uint32_t dt, float totalAnimTimeMod)
+void AnimatedButton::OnExecuteAnimationFinished(void* button)
 {
-	mAnimationTime += static_cast<int>(dt);
-
-	int totalAnimTime = static_cast<int>(mTotalAnimationTime * totalAnimTimeMod);
-
-	if (mAnimationTime >= totalAnimTime)
-	{
-		mAnimationTime = totalAnimTime;
-		mIsAnimating = false;
-	}
-
-	float elapsedSeconds = MillisecondsToSeconds(mAnimationTime);
-	float totalSeconds = MillisecondsToSeconds(totalAnimTime);
+	AnimatedButton* animatedButton = static_cast<AnimatedButton*>(button);
 
-	return elapsedSeconds / totalSeconds;
+	animatedButton->mExecuteTween = INVALID_TWEEN_HANDLE;
+	animatedButton->mExecuteTriggered = false;
+	animatedButton->Button::ExecuteAction();
 }
 
 void AnimatedButton::SetupLetterAnimationData(const std::string& text)
@@ -3,11 +3,18 @@
 
 
 #include "Button.h"
+#include "TweenEngine.h"
 
 class AnimatedButton : public Button
 {
 public:
 	AnimatedButton(const BitmapFont& bitmapFont, const Color& textColor, const Color& highlightColor = Color::White());
+	virtual ~AnimatedButton();
+
+	//The running tweens point at this button's members
+	AnimatedButton(const AnimatedButton&) = delete;
+	AnimatedButton& operator=(const AnimatedButton&) = delete;
+
 	virtual void Init(const std::string& text, Vec2D topLeft, unsigned int width, unsigned height) override;
 	virtual void Update(uint32_t dt) override;
 	virtual void ExecuteAction() override;
@@ -17,16 +24,17 @@ public:
 
 private:
 
-	float UpdateAnimationTime(uint32_t dt, float totalAnimTimeMod = 1.0f);
+	static void OnExecuteAnimationFinished(void* button);
 	void SetupLetterAnimationData(const std::string& text);
 	void UpdateLetterAnimationData();
 	void DrawButtonAnimation(Screen& theScreen);
 
 
 	Color mOriginalColor;
-	int mTotalAnimationTime;
-	int mAnimationTime;
-	bool mIsAnimating;
+	//Both run in the App's TweenEngine, after Update() has reset what they animate
+	TweenHandle mBounceTween;
+	TweenHandle mExecuteTween;
+	bool mStartBounce; //on the next update, the text position isn't known until Init()
 
 	bool mExecuteTriggered;
 
@@ -8,7 +8,12 @@
 #include "App.h"
 #include <SDL2/SDL.h>
 #include <iostream>
+#include <filesystem>
 #include "ArcadeScene.h"
+#include "AssetTables.h"
+#include "AtlasPacking.h"
+#include "SpriteSheet.h"
+#include "Profiler.h"
 #include <cassert>
 
 App& App::Singleton()
@@ -21,9 +26,58 @@ bool App::Init(uint32_t width, uint32_t height, uint32_t mag)
 {
 	
 
-	mnoptrWindow = mScreen.Init(width, height, mag);
+	{
+		PROFILE_ZONE("ScreenInit");
+		mnoptrWindow = mScreen.Init(width, height, mag);
+	}
+
+	if (mnoptrWindow)
+	{
+		SDL_DisplayMode displayMode;
+		if (SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(mnoptrWindow), &displayMode) == 0 && displayMode.refresh_rate > 0)
+		{
+			mFrameStats.SetTargetRefreshRate(static_cast<uint32_t>(displayMode.refresh_rate));
+		}
+	}
+
+	//Optional - built by Tools/AssetPacker, without it everything is loaded from the text files and bmps
+	if (mAssetPack.Open(GetBasePath() + "assets/Assets.pack"))
+	{
+		std::cout << "Using assets/Assets.pack" << std::endl;
+
+#ifndef RELEASE
+		//An edited file wins over what the pack has of it until AssetPacker is run again. Release trusts the pack.
+		for (const std::string& staleName : mAssetPack.FindStaleEntries(GetBasePath() + "assets/"))
+		{
+			std::cout << "assets/" << staleName << " has changed since Assets.pack was built, loading it from the file - rerun AssetPacker" << std::endl;
+			IgnoreAssetTable(staleName);
+		}
+#endif
+	}
+
+#ifndef RELEASE
+	if (mWatchedAssetsDirectory.empty())
+	{
+		//The build copies ArcadeApp/assets to bin/<config>/ArcadeApp/assets - edits are made to the original
+		const std::string sourceAssetsDirectory = GetBasePath() + "../../../ArcadeApp/assets/";
 
-	if (!mFont.Load("ArcadeFont"))
+		std::error_code error;
+		mWatchedAssetsDirectory = std::filesystem::is_directory(sourceAssetsDirectory, error) ? sourceAssetsDirectory : GetBasePath() + "assets/";
+	}
+
+	if (mAssetWatcher.Start(mWatchedAssetsDirectory))
+	{
+		std::cout << "Hot reloading " << mWatchedAssetsDirectory << std::endl;
+	}
+#endif
+
+	bool fontLoaded;
+	{
+		PROFILE_ZONE("FontLoad");
+		fontLoaded = mFont.Load("ArcadeFont");
+	}
+
+	if (!fontLoaded)
 	{
 		std::cout << "Could not load arcade font!" << std::endl;
 		return false;
@@ -52,46 +106,246 @@ void App::Run()
 			running = false;
 		});
 
+#ifdef ARCADE_PROFILER
+		ButtonAction toggleProfiler;
+		toggleProfiler.key = static_cast<InputKey>(SDLK_BACKQUOTE);
+		toggleProfiler.action = [](uint32_t dt, InputState state){
+			if(state == SDL_PRESSED)
+			{
+				profiler::ToggleOverlay();
+			}
+		};
+		mInputController.AddGlobalKeyAction(toggleProfiler);
+#endif
+
+		std::chrono::steady_clock::time_point lastFrameStart = std::chrono::steady_clock::now();
+		bool firstFrame = true;
 
 		while(running)
 		{
+			PROFILE_BEGIN_FRAME();
+
+			std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+
 			currentTick = SDL_GetTicks();
 			uint32_t frameTime = currentTick - lastTick;
+			bool clamped = false;
 
 			if(frameTime > 300)
 			{
 				frameTime = 300;
+				clamped = true;
 			}
 
 			lastTick = currentTick;
 
 			accumulator += frameTime;
 
+			if(mPendingScene)
+			{
+				if(TopScene())
+				{
+					TopScene()->Shutdown(mScreen);
+					mSceneStack.pop_back();
+				}
+
+				PushScene(std::move(mPendingScene));
+			}
+
+			ReloadChangedAssets();
+
 			//Input
-			mInputController.Update(dt);
+			{
+				PROFILE_ZONE("Input");
+				mInputController.Update(dt);
+			}
 
 			Scene* topScene = App::TopScene();
 			assert(topScene && "Why don't have a scene?");
 
+			std::chrono::steady_clock::time_point updateStart = std::chrono::steady_clock::now();
+			std::chrono::steady_clock::time_point renderStart = updateStart;
+
 			if(topScene)
 			{
 				//Update
 				while(accumulator >= dt)
 				{
 					//update current scene by dt
-					topScene->Update(dt);
+					{
+						PROFILE_ZONE("Update");
+						topScene->Update(dt);
+					}
+					mAnimationSystem.Update();
+					mTweenEngine.Update(dt);
 					mScreen.Update(dt);
 					accumulator -= dt;
 					
 				}
+				renderStart = std::chrono::steady_clock::now();
+
 				//Render
-				topScene->Draw(mScreen);
-				
+				{
+					PROFILE_ZONE("Draw");
+					topScene->Draw(mScreen);
+				}
+			}
+
+			PROFILE_DRAW_OVERLAY(mScreen, mFont);
+#ifdef ARCADE_PROFILER
+			if(profiler::IsOverlayVisible())
+			{
+				mFrameStats.DrawOverlay(mScreen, mFont);
+			}
+#endif
+
+			{
+				PROFILE_ZONE("Swap");
+				mScreen.SwapScreens();
+			}
+
+			std::chrono::steady_clock::time_point renderEnd = std::chrono::steady_clock::now();
+
+			//Start to start, so waiting on the vsync counts - the first frame has nothing to measure from
+			if(!firstFrame)
+			{
+				mFrameStats.RecordFrame(
+					static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(frameStart - lastFrameStart).count()),
+					static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(renderStart - updateStart).count()),
+					static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(renderEnd - renderStart).count()),
+					clamped);
+			}
+
+			firstFrame = false;
+			lastFrameStart = frameStart;
+
+			if(!mReloadedAssets.empty())
+			{
+				ReportReloadLatency();
+				mReloadedAssets.clear();
+			}
+
+			PROFILE_END_FRAME();
+		}
+
+		mFrameStats.WriteReport();
+		mFrameStats.PrintSummary();
+	}
+}
+
+void App::ReportFrameStats(const std::string& filePath)
+{
+	mFrameStats.ReportTo(filePath);
+}
+
+void App::WatchAssets(const std::string& directory)
+{
+	mWatchedAssetsDirectory = directory;
+
+	if (!mWatchedAssetsDirectory.empty() && mWatchedAssetsDirectory.back() != '/' && mWatchedAssetsDirectory.back() != '\\')
+	{
+		mWatchedAssetsDirectory += '/';
+	}
+}
+
+void App::ReloadChangedAssets()
+{
+	std::vector<AssetChange> changes = mAssetWatcher.Poll();
+
+	const std::string assetsDirectory = GetBasePath() + "assets/";
+	std::error_code error;
+	const bool watchingAssetsDirectory = !changes.empty() && std::filesystem::equivalent(mWatchedAssetsDirectory, assetsDirectory, error);
+
+	for(AssetChange& change : changes)
+	{
+		//Everything loads from assets/, bring the edited file over first
+		if(!watchingAssetsDirectory)
+		{
+			std::filesystem::copy_file(mWatchedAssetsDirectory + change.fileName, assetsDirectory + change.fileName, std::filesystem::copy_options::overwrite_existing, error);
+
+			if(error)
+			{
+				std::cout << "Could not copy " << change.fileName << " into " << assetsDirectory << " - " << error.message() << std::endl;
+				continue;
 			}
+		}
+
+		//The pack was built from the old file
+		IgnoreAssetTable(change.fileName);
+
+		bool reloaded = ReloadSpriteSheet(change.fileName);
+
+		//The games draw the packed sheet made from it at build time, pack it again
+		const size_t extensionPos = change.fileName.find_last_of('.');
+		const std::string extension = extensionPos == std::string::npos ? "" : change.fileName.substr(extensionPos);
+		const std::string sheetName = change.fileName.substr(0, extensionPos);
+		const std::string packedSheetName = PackedSheetName(sheetName);
+
+		if((extension == ".bmp" || extension == ".txt") && mAssetManager.FindLoaded<SpriteSheet>(packedSheetName))
+		{
+			AtlasPackStats stats;
+
+			if(PackAtlas(assetsDirectory, assetsDirectory, sheetName, stats))
+			{
+				IgnoreAssetTable(packedSheetName);
+				reloaded = ReloadSpriteSheet(packedSheetName + ".bmp") || reloaded;
+			}
+			else
+			{
+				std::cout << "Could not repack " << change.fileName << " into " << packedSheetName << std::endl;
+			}
+		}
 
-			mScreen.SwapScreens();
+		if(mAnimationLibrary.ReloadFile(change.fileName, [this](const std::string& name) {
+			return mAssetManager.FindLoaded<SpriteSheet>(name).get();
+		}))
+		{
+			//Frame counts and fps may have changed under animations that are playing
+			mAnimationSystem.RefreshAnimations();
+			reloaded = true;
+		}
+
+		if(reloaded)
+		{
+			mReloadedAssets.push_back(std::move(change));
 		}
 	}
+
+	if(!mReloadedAssets.empty())
+	{
+		mReloadFinishedTime = std::chrono::system_clock::now();
+	}
+}
+
+bool App::ReloadSpriteSheet(const std::string& fileName)
+{
+	if(mAssetManager.Reload(fileName) == 0)
+	{
+		return false;
+	}
+
+	if(std::shared_ptr<const SpriteSheet> spriteSheet = mAssetManager.FindLoaded<SpriteSheet>(fileName.substr(0, fileName.find_last_of('.'))))
+	{
+		//Its sections may have moved
+		mAnimationLibrary.ResolveSprites(*spriteSheet);
+	}
+
+	return true;
+}
+
+void App::ReportReloadLatency() const
+{
+	using Milliseconds = std::chrono::duration<float, std::milli>;
+
+	const std::chrono::system_clock::time_point frameTime = std::chrono::system_clock::now();
+
+	for(const AssetChange& change : mReloadedAssets)
+	{
+		std::cout << "Reloaded " << change.fileName
+				  << " - detected " << Milliseconds(change.detectedTime - change.savedTime).count() << "ms after saving"
+				  << ", reloaded in " << Milliseconds(mReloadFinishedTime - change.detectedTime).count() << "ms"
+				  << ", on screen " << Milliseconds(frameTime - change.savedTime).count() << "ms after saving" << std::endl;
+	}
 }
 
 void App::PushScene(std::unique_ptr<Scene> scene)
@@ -99,7 +353,11 @@ void App::PushScene(std::unique_ptr<Scene> scene)
 	assert(scene && "Don't push nullptr");
 	if(scene)
 	{
-		scene->Init();
+		{
+			PROFILE_ZONE("SceneInit");
+			scene->Init();
+		}
+
 		mInputController.SetGameController(scene->GetGameController());
 		mSceneStack.emplace_back(std::move(scene));
 		SDL_SetWindowTitle(mnoptrWindow, TopScene()->GetSceneName().c_str());
@@ -125,6 +383,12 @@ void App::PopScene()
 	}
 }
 
+void App::ReplaceTopScene(std::unique_ptr<Scene> scene)
+{
+	assert(scene && "Don't replace with nullptr");
+	mPendingScene = std::move(scene);
+}
+
 Scene* App::TopScene() //current scene
 {
 	if(mSceneStack.empty())
@@ -15,6 +15,14 @@
 #include "Scene.h"
 #include "InputController.h"
 #include "BitmapFont.h"
+#include "AssetPack.h"
+#include "AnimationLibrary.h"
+#include "AnimationSystem.h"
+#include "ThreadPool.h"
+#include "AssetManager.h"
+#include "AssetWatcher.h"
+#include "TweenEngine.h"
+#include "FrameStats.h"
 
 struct SDL_Window;
 
@@ -24,27 +32,60 @@ public:
 	static App& Singleton();
 	bool Init(uint32_t width, uint32_t height, uint32_t mag);
 	void Run();
+	//Before Run() - frame stats go to filePath every so often and on exit
+	void ReportFrameStats(const std::string& filePath);
+	//Before Init() - hot reload watches directory instead of ArcadeApp/assets in the source tree
+	void WatchAssets(const std::string& directory);
 
 	inline uint32_t Width() const {return mScreen.Width();}
 	inline uint32_t Height() const {return mScreen.Height();}
 
 	void PushScene(std::unique_ptr<Scene> scene);
 	void PopScene();
+	//Swaps the top scene out at the start of the next frame, safe to call from the top scene's own Update()
+	void ReplaceTopScene(std::unique_ptr<Scene> scene);
 	Scene* TopScene(); //current scene
 
 	static const std::string& GetBasePath();
 	inline const BitmapFont& GetFont() const {return mFont;}
+	inline const AssetPack& GetAssetPack() const {return mAssetPack;}
+	inline AnimationLibrary& GetAnimationLibrary() {return mAnimationLibrary;}
+	inline AnimationSystem& GetAnimationSystem() {return mAnimationSystem;}
+	inline TweenEngine& GetTweenEngine() {return mTweenEngine;}
+	inline ThreadPool& GetThreadPool() {return mThreadPool;}
+	inline AssetManager& GetAssetManager() {return mAssetManager;}
+	inline const FrameStats& GetFrameStats() const {return mFrameStats;}
 	Screen& GetScreen() { return mScreen; }
 
 	uint32_t GetCurrentTime() const;
 private:
+	//Hot reload - picks up whatever was saved into the watched directory since the last frame
+	void ReloadChangedAssets();
+	//Reloads whatever was loaded from fileName, a sprite sheet's animations get its new sections
+	bool ReloadSpriteSheet(const std::string& fileName);
+	void ReportReloadLatency() const;
+
 	Screen mScreen;
 	SDL_Window * mnoptrWindow;
 
+	AnimationSystem mAnimationSystem; //before the scenes, their sprites give their slots back when they're destroyed
+	TweenEngine mTweenEngine; //same, scenes cancel their tweens
 	std::vector<std::unique_ptr<Scene>> mSceneStack;
+	std::unique_ptr<Scene> mPendingScene;
 	InputController mInputController;
 
+	AssetPack mAssetPack;
+	AnimationLibrary mAnimationLibrary;
+	AssetManager mAssetManager;
+	ThreadPool mThreadPool; //after everything its jobs use so it's shut down first
 	BitmapFont mFont;
+
+	FrameStats mFrameStats;
+
+	AssetWatcher mAssetWatcher;
+	std::string mWatchedAssetsDirectory; //where the assets are edited, changes are copied into assets/ to load them
+	std::vector<AssetChange> mReloadedAssets; //reported once the frame using them is on screen
+	std::chrono::system_clock::time_point mReloadFinishedTime;
 };
 
 
@@ -25,7 +25,20 @@ void Button::Init(const std::string& text, Vec2D topLeft, unsigned int width, un
 {
 	mBBox = AARectangle(topLeft, width, height);
 
-	mDrawPosition = mBitmapFont.GetDrawPosition(mTitle, mBBox, BFXA_CENTER, BFYA_CENTER);
+	UpdateTextPosition();
+}
+
+void Button::SetButtonText(const std::string& text)
+{
+	mTitle = text;
+
+	UpdateTextPosition();
+}
+
+void Button::UpdateTextPosition()
+{
+	mTextPosition = mBitmapFont.GetDrawPosition(mTitle, mBBox, BFXA_CENTER, BFYA_CENTER);
+	mDrawPosition = mTextPosition;
 }
 
 void Button::Draw(Screen& theScreen)
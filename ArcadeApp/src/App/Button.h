@@ -24,12 +24,13 @@ public:
 	using ButtonAction = std::function<void(void)>;
 
 	Button(const BitmapFont& bitmapFont, const Color& textColor, const Color& highlightColor = Color::White());
+	virtual ~Button() {}
 	virtual void Init(const std::string& text, Vec2D topLeft, unsigned int width, unsigned height);
 	virtual void Update(uint32_t dt) {}
 	virtual void Draw(Screen& theScreen);
 	virtual void ExecuteAction();
 
-	inline void SetButtonText(const std::string& text) {mTitle = text;}
+	void SetButtonText(const std::string& text);
 	inline const std::string& GetButtonText() const {return mTitle;}
 	virtual void SetHighlighted(bool highlighted) {mHighlighted = highlighted;}
 	inline bool IsHighlighted() const {return mHighlighted;}
@@ -38,8 +39,10 @@ public:
 protected:
 
 	void DrawHighlight(Screen& theScreen);
+	void UpdateTextPosition();
 
 	Vec2D mDrawPosition;
+	Vec2D mTextPosition; //centered text position, only changes with the title or the box
 	float mTextScale;
 	const BitmapFont& mBitmapFont;
 	std::string mTitle;
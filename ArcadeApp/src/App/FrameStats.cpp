@@ -0,0 +1,181 @@
+/*
+ * FrameStats.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "FrameStats.h"
+#include "Screen.h"
+#include "BitmapFont.h"
+#include "AARectangle.h"
+#include "Profiler.h"
+#include <fstream>
+#include <iostream>
+#include <cstdio>
+
+namespace
+{
+	const uint64_t MAX_TRACKED_TIME = 10000000; //10s, anything longer is in the top bucket
+	const uint32_t DEFAULT_REFRESH_RATE = 60;
+
+	double ToMS(uint64_t microseconds)
+	{
+		return static_cast<double>(microseconds) / 1000.0;
+	}
+
+	void WritePercentiles(std::ofstream& out, const char* name, const Histogram& histogram, bool last)
+	{
+		out << "\t\"" << name << "\": {"
+			<< "\"p50\": " << ToMS(histogram.ValueAtPercentile(50.0))
+			<< ", \"p90\": " << ToMS(histogram.ValueAtPercentile(90.0))
+			<< ", \"p99\": " << ToMS(histogram.ValueAtPercentile(99.0))
+			<< ", \"p99.9\": " << ToMS(histogram.ValueAtPercentile(99.9))
+			<< ", \"max\": " << ToMS(histogram.Max())
+			<< ", \"mean\": " << histogram.Mean() / 1000.0
+			<< "}" << (last ? "" : ",") << std::endl;
+	}
+
+	void PrintPercentiles(const char* name, const Histogram& histogram)
+	{
+		std::printf("%-7s p50 %7.2fms  p90 %7.2fms  p99 %7.2fms  p99.9 %7.2fms  max %7.2fms\n", name,
+			ToMS(histogram.ValueAtPercentile(50.0)),
+			ToMS(histogram.ValueAtPercentile(90.0)),
+			ToMS(histogram.ValueAtPercentile(99.0)),
+			ToMS(histogram.ValueAtPercentile(99.9)),
+			ToMS(histogram.Max()));
+	}
+
+	void DrawHistogram(Screen& screen, const BitmapFont& font, float y, const std::string& name, const Histogram& histogram)
+	{
+		const std::string columns[profiler::OVERLAY_NUM_COLUMNS] = {
+			profiler::FormatOverlayMS(ToMS(histogram.ValueAtPercentile(90.0))),
+			profiler::FormatOverlayMS(ToMS(histogram.ValueAtPercentile(99.0))),
+			profiler::FormatOverlayMS(ToMS(histogram.ValueAtPercentile(99.9))),
+			profiler::FormatOverlayMS(ToMS(histogram.Max()))
+		};
+
+		profiler::DrawOverlayRow(screen, font, y, name, columns, Color::White());
+	}
+}
+
+FrameStats::FrameStats():
+	mFrameTimes(MAX_TRACKED_TIME),
+	mUpdateTimes(MAX_TRACKED_TIME),
+	mRenderTimes(MAX_TRACKED_TIME),
+	mNumLateFrames(0),
+	mNumDroppedFrames(0),
+	mNumClampedFrames(0),
+	mTargetRefreshRate(0),
+	mRefreshInterval(0),
+	mReportInterval(0),
+	mTimeSinceReport(0)
+{
+	SetTargetRefreshRate(DEFAULT_REFRESH_RATE);
+}
+
+void FrameStats::SetTargetRefreshRate(uint32_t refreshRate)
+{
+	mTargetRefreshRate = refreshRate > 0 ? refreshRate : DEFAULT_REFRESH_RATE;
+	mRefreshInterval = 1000000 / mTargetRefreshRate;
+}
+
+void FrameStats::RecordFrame(uint64_t frameTime, uint64_t updateTime, uint64_t renderTime, bool clamped)
+{
+	mFrameTimes.Record(frameTime);
+	mUpdateTimes.Record(updateTime);
+	mRenderTimes.Record(renderTime);
+
+	if(frameTime * 2 > mRefreshInterval * 3)
+	{
+		++mNumLateFrames;
+		//Rounded - a frame that took 2 intervals missed 1 vsync
+		mNumDroppedFrames += (frameTime + mRefreshInterval / 2) / mRefreshInterval - 1;
+	}
+
+	if(clamped)
+	{
+		++mNumClampedFrames;
+	}
+
+	if(!mReportPath.empty())
+	{
+		mTimeSinceReport += frameTime;
+
+		if(mTimeSinceReport >= mReportInterval)
+		{
+			mTimeSinceReport = 0;
+			WriteReport();
+		}
+	}
+}
+
+void FrameStats::ReportTo(const std::string& filePath, uint32_t intervalMS)
+{
+	mReportPath = filePath;
+	mReportInterval = static_cast<uint64_t>(intervalMS) * 1000;
+	mTimeSinceReport = 0;
+}
+
+bool FrameStats::WriteReport() const
+{
+	if(mReportPath.empty())
+	{
+		return false;
+	}
+
+	std::ofstream out(mReportPath, std::ios::trunc);
+
+	if(!out.is_open())
+	{
+		std::cout << "Could not write the frame stats to " << mReportPath << std::endl;
+		return false;
+	}
+
+	out << "{" << std::endl;
+	out << "\t\"targetRefreshRate\": " << mTargetRefreshRate << "," << std::endl;
+	out << "\t\"frames\": " << mFrameTimes.Count() << "," << std::endl;
+	out << "\t\"lateFrames\": " << mNumLateFrames << "," << std::endl;
+	out << "\t\"droppedFrames\": " << mNumDroppedFrames << "," << std::endl;
+	out << "\t\"clampedFrames\": " << mNumClampedFrames << "," << std::endl;
+	WritePercentiles(out, "frameMS", mFrameTimes, false);
+	WritePercentiles(out, "updateMS", mUpdateTimes, false);
+	WritePercentiles(out, "renderMS", mRenderTimes, true);
+	out << "}" << std::endl;
+
+	return true;
+}
+
+void FrameStats::PrintSummary() const
+{
+	std::cout << mFrameTimes.Count() << " frames at " << mTargetRefreshRate << "Hz - " << mNumLateFrames << " late, "
+			  << mNumDroppedFrames << " vsyncs missed, " << mNumClampedFrames << " clamped" << std::endl;
+
+	PrintPercentiles("Frame", mFrameTimes);
+	PrintPercentiles("Update", mUpdateTimes);
+	PrintPercentiles("Render", mRenderTimes);
+}
+
+void FrameStats::DrawOverlay(Screen& screen, const BitmapFont& font) const
+{
+	const float height = profiler::OVERLAY_LINE_HEIGHT * 5 + 2.0f;
+	float y = static_cast<float>(screen.Height()) - height + 1.0f;
+
+	const Color background(0, 0, 0, profiler::OVERLAY_BACKGROUND_ALPHA);
+	screen.Draw(AARectangle(Vec2D(0.0f, y - 1.0f), screen.Width(), static_cast<unsigned int>(height)), background, true, background);
+
+	const std::string header[profiler::OVERLAY_NUM_COLUMNS] = {"P90", "P99", "P999", "MAX"};
+	profiler::DrawOverlayRow(screen, font, y, "MS", header, Color::Yellow());
+	y += profiler::OVERLAY_LINE_HEIGHT;
+
+	DrawHistogram(screen, font, y, "FRAME", mFrameTimes);
+	y += profiler::OVERLAY_LINE_HEIGHT;
+
+	DrawHistogram(screen, font, y, "UPDATE", mUpdateTimes);
+	y += profiler::OVERLAY_LINE_HEIGHT;
+
+	DrawHistogram(screen, font, y, "RENDER", mRenderTimes);
+	y += profiler::OVERLAY_LINE_HEIGHT;
+
+	screen.Draw(font, "LATE " + std::to_string(mNumLateFrames) + "  DROPPED " + std::to_string(mNumDroppedFrames), Vec2D(profiler::OVERLAY_NAME_X, y), Color::Cyan());
+}
@@ -0,0 +1,63 @@
+/*
+ * FrameStats.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef APP_FRAMESTATS_H_
+#define APP_FRAMESTATS_H_
+
+#include "Histogram.h"
+#include <string>
+#include <stdint.h>
+
+class Screen;
+class BitmapFont;
+
+//Owned by the App - frame, update and render times of every frame since startup, for soak runs.
+//Late frames took more than one and a half refresh intervals, dropped frames counts every vsync they missed.
+//Times are in microseconds.
+class FrameStats
+{
+public:
+	static const uint32_t DEFAULT_REPORT_INTERVAL_MS = 10000;
+
+	FrameStats();
+
+	void SetTargetRefreshRate(uint32_t refreshRate);
+	//clamped - the App capped the frame time it simulated (the 300ms limit in App::Run)
+	void RecordFrame(uint64_t frameTime, uint64_t updateTime, uint64_t renderTime, bool clamped);
+
+	//Rewrites filePath as JSON every intervalMS of frame time, and when WriteReport() is called
+	void ReportTo(const std::string& filePath, uint32_t intervalMS = DEFAULT_REPORT_INTERVAL_MS);
+	bool WriteReport() const;
+	void PrintSummary() const;
+
+	//Bottom of the screen
+	void DrawOverlay(Screen& screen, const BitmapFont& font) const;
+
+	inline const Histogram& GetFrameTimes() const {return mFrameTimes;}
+	inline const Histogram& GetUpdateTimes() const {return mUpdateTimes;}
+	inline const Histogram& GetRenderTimes() const {return mRenderTimes;}
+	inline uint64_t NumLateFrames() const {return mNumLateFrames;}
+	inline uint64_t NumDroppedFrames() const {return mNumDroppedFrames;}
+	inline uint64_t NumClampedFrames() const {return mNumClampedFrames;}
+	inline uint32_t GetTargetRefreshRate() const {return mTargetRefreshRate;}
+
+private:
+	Histogram mFrameTimes;
+	Histogram mUpdateTimes;
+	Histogram mRenderTimes;
+	uint64_t mNumLateFrames;
+	uint64_t mNumDroppedFrames;
+	uint64_t mNumClampedFrames;
+	uint32_t mTargetRefreshRate;
+	uint64_t mRefreshInterval;
+
+	std::string mReportPath;
+	uint64_t mReportInterval;
+	uint64_t mTimeSinceReport;
+};
+
+#endif /* APP_FRAMESTATS_H_ */
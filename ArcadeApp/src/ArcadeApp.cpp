@@ -8,6 +8,8 @@
 
 #include <iostream>
 #include "App.h"
+#include "Profiler.h"
+#include <cstring>
 
 const int SCREEN_WIDTH = 224;
 const int SCREEN_HEIGHT = 288;
@@ -17,11 +19,40 @@ using namespace std;
 
 int main(int argc, const char * argv[])
 {
+	for(int i = 1; i + 1 < argc; ++i)
+	{
+		//--frame-stats <file.json> - frame time percentiles, for soak runs
+		if(strcmp(argv[i], "--frame-stats") == 0)
+		{
+			App::Singleton().ReportFrameStats(argv[i + 1]);
+		}
+		//--watch-assets <directory> - hot reload from somewhere other than ArcadeApp/assets
+		else if(strcmp(argv[i], "--watch-assets") == 0)
+		{
+			App::Singleton().WatchAssets(argv[i + 1]);
+		}
+#ifdef ARCADE_PROFILER
+		//--trace <file.json> - before Init so the startup shows up too
+		else if(strcmp(argv[i], "--trace") == 0)
+		{
+			profiler::StartTrace(argv[i + 1]);
+		}
+#endif
+	}
+
 	if(App::Singleton().Init(SCREEN_WIDTH, SCREEN_HEIGHT, MAGNIFICATION))
 	{
 		App::Singleton().Run();
 	}
 
+#ifdef ARCADE_PROFILER
+	profiler::StopTrace();
+#endif
+
+#ifdef ARCADE_TRACK_ALLOCATIONS
+	profiler::ReportAllocations();
+#endif
+
     return 0;
 }
 
@@ -23,7 +23,7 @@ namespace
 }
 
 Asteroid::Asteroid() 
-: mSpriteName ("")
+: mSpriteId (INVALID_SPRITE_ID)
 , mBoundingCircle{}
 , mVelocity{}
 , mSpawnPosition{}
@@ -43,11 +43,11 @@ Asteroid::Asteroid()
 void Asteroid::Init(const SpriteSheet& spriteSheet, const std::string& spriteName, Size size, const Vec2D& initialPos, const Vec2D& velocity, float rotationRate)
 {
     
-    mSpriteName = spriteName;
+    mSpriteId = spriteSheet.GetSpriteId(spriteName);
     mSprite.Init(App::Singleton().GetBasePath() + "assets/AsteroidsAnimations.txt", spriteSheet);
 
     mVelocity = velocity;
-    const auto & sprite = spriteSheet.GetSprite(spriteName);
+    const auto & sprite = spriteSheet.GetSprite(mSpriteId);
     mRotationRate = rotationRate;
     mBoundingCircle = Circle(initialPos, static_cast<float>(sprite.width) / 2.0f);
     mSpawnPosition = initialPos;
@@ -93,7 +93,7 @@ void Asteroid::Draw(Screen& theScreen)
 
     if (!mHit)
     {
-        const auto& sprite = mSprite.GetSpriteSheet()->GetSprite(mSpriteName);
+        const auto& sprite = mSprite.GetSpriteSheet()->GetSprite(mSpriteId);
 
         DrawTransform transform;
         transform.pos = mBoundingCircle.GetCenterPoint() - Vec2D(static_cast<float>(sprite.width) / 2.0f, static_cast<float>(sprite.height) / 2.0f);
@@ -111,7 +111,7 @@ void Asteroid::Draw(Screen& theScreen)
 
 		theScreen.Draw(
             *mSprite.GetSpriteSheet(),
-			mSpriteName,
+			mSpriteId,
 			transform,
             colorParams,
             uvParams);
@@ -157,7 +157,7 @@ void Asteroid::HitByAmmo(const std::vector<Vec2D>& intersections)
 		mSplitPoint2 = intersections[1]; // in worldspace
         mSplitTime = 0;
 
-        const auto& sprite = mSprite.GetSpriteSheet()->GetSprite(mSpriteName);
+        const auto& sprite = mSprite.GetSpriteSheet()->GetSprite(mSpriteId);
         mPosAtSplitTime = mBoundingCircle.GetCenterPoint() - Vec2D(static_cast<float>(sprite.width) / 2.0f, static_cast<float>(sprite.height) / 2.0f);
         mRotationAtSplit = mRotation;
     }
@@ -197,7 +197,7 @@ void Asteroid::DrawAsteroidSplit(Screen& theScreen, float alpha)
 
 	theScreen.Draw(
 		*mSprite.GetSpriteSheet(),
-		mSpriteName,
+		mSpriteId,
 		transform,
 		colorParams,
 		uvParams);
@@ -207,7 +207,7 @@ void Asteroid::DrawAsteroidSplit(Screen& theScreen, float alpha)
 
 	theScreen.Draw(
 		*mSprite.GetSpriteSheet(),
-		mSpriteName,
+		mSpriteId,
 		transform,
 		colorParams,
 		uvParams);
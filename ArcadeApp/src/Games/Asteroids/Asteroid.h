@@ -60,7 +60,7 @@ private:
 
 
     AnimatedSprite mSprite;
-    std::string mSpriteName;
+    SpriteId mSpriteId;
     Circle mBoundingCircle;
     Vec2D mVelocity;
     Vec2D mSpawnPosition;
@@ -11,6 +11,7 @@
 #include "AsteroidsConstants.h"
 #include "GameController.h"
 #include "Utils.h"
+#include "AssetLoader.h"
 #include <SDL2/SDL.h>
 #include <cassert>
 
@@ -43,20 +44,26 @@ namespace {
 }
 
 AsteroidsGame::AsteroidsGame()
+    : mBigRockSpriteId(INVALID_SPRITE_ID)
+    , mScoreHUD(Screen::INVALID_HUD_ELEMENT)
+    , mLivesHUD(Screen::INVALID_HUD_ELEMENT)
+    , mAmmoHUD(Screen::INVALID_HUD_ELEMENT)
 {
     std::random_device r;
     mRandomGenerator.seed(r());
 }
 
+void AsteroidsGame::LoadAssets(AssetLoader& loader)
+{
+    loader.Load(mAsteroidsSprites, "AsteroidsSpritesPacked", {App::Singleton().GetBasePath() + "assets/AsteroidsAnimations.txt"});
+    loader.Load(mBGImage, App::Singleton().GetBasePath() + std::string("assets/") + "StarrySpace.bmp");
+}
+
 void AsteroidsGame::Init(GameController& controller)
 {
-    mAsteroidsSprites.Load("AsteroidsSprites");
-    
-    bool loaded = mBGImage.Load(App::Singleton().GetBasePath() + std::string("assets/") + "StarrySpace.bmp");
-    
-    assert(loaded);
+    mBigRockSpriteId = mAsteroidsSprites->GetSpriteId(asteroidNames[0]);
 
-    mShip.Init(mAsteroidsSprites, Vec2D(static_cast<float>(App::Singleton().Width()) /2.0f, static_cast<float>(App::Singleton().Height()) /2.0f));
+    mShip.Init(*mAsteroidsSprites, Vec2D(static_cast<float>(App::Singleton().Width()) /2.0f, static_cast<float>(App::Singleton().Height()) /2.0f));
     
     mStringRect = AARectangle(Vec2D(0.0f, static_cast<float>(App::Singleton().Height())/2.0f - 50.0f), App::Singleton().Width(), 100);
 
@@ -141,10 +148,10 @@ void AsteroidsGame::Init(GameController& controller)
     controller.AddInputActionForKey(cancelKey);
 
 	Sprite bgSprite;
-	bgSprite.width = mBGImage.GetWidth();
-	bgSprite.height = mBGImage.GetHeight();
+	bgSprite.width = mBGImage->GetWidth();
+	bgSprite.height = mBGImage->GetHeight();
 
-	App::Singleton().GetScreen().DrawBackground(mBGImage, bgSprite, Vec2D::Zero);
+	App::Singleton().GetScreen().DrawBackground(*mBGImage, bgSprite, Vec2D::Zero);
 
 }
 
@@ -190,12 +197,6 @@ void AsteroidsGame::Draw(Screen& screen)
     Vec2D textDrawPosition;
     const auto& font = App::Singleton().GetFont();
 
-    //draw the score
-
-    float screenWidth = static_cast<float>(App::Singleton().Width());
-    float screenHeight = static_cast<float>(App::Singleton().Height());
-
-
 	DrawTransform transform;
 	transform.pos = Vec2D::Zero;
 	transform.rotationAngle = 0.0f;
@@ -208,112 +209,140 @@ void AsteroidsGame::Draw(Screen& screen)
 	colorParams.gradient.yParam = GradientYParam::NO_Y_GRADIENT;
     colorParams.overlay = Color::White();
 
-	UVParams uvParams;
-
-    {
-        AARectangle highScoreRect = AARectangle(Vec2D(0.0f, 2.0f), static_cast<uint32_t>(screenWidth / 2.0f), 20);
-
-		textDrawPosition = font.GetDrawPosition(SCORE_STR, highScoreRect, BFXA_LEFT, BFYA_CENTER);
-        textDrawPosition = textDrawPosition + Vec2D(5.0f, 0.0f);
-
-        transform.pos = textDrawPosition;
-
-		screen.Draw(font, SCORE_STR, transform, colorParams, uvParams);
-
-        highScoreRect = AARectangle(Vec2D(screenWidth /2.0f, 2.0f), static_cast<uint32_t>(screenWidth / 2.0f), 20);
-
-        std::string scoreStr = std::to_string(mScore);
-
-		textDrawPosition = font.GetDrawPosition(scoreStr, highScoreRect, BFXA_RIGHT, BFYA_CENTER);
-        textDrawPosition = textDrawPosition - Vec2D(5, 0);
-
-        transform.pos = textDrawPosition;
-
-		screen.Draw(font, scoreStr, transform, colorParams, uvParams);
-
-    }
-
-
-	const float X_PAD = 1.0f;
-
-	auto sprite = mAsteroidsSprites.GetSprite(SPACE_SHIP_SPRITE_NAME);
-    float xPos = X_PAD;
-    const float scale = 0.75f;
-
-    for (int i = 0; i < mLives; ++i)
+    //The HUD only changes when the score, lives or ammo do - it's re-rendered then and composited otherwise
+    if (mScoreHUD == Screen::INVALID_HUD_ELEMENT)
     {
-        transform.pos = Vec2D(xPos, screenHeight - static_cast<float>(sprite.height));
-        transform.scale = scale;
-        
-		screen.Draw(mAsteroidsSprites, SPACE_SHIP_SPRITE_NAME, transform, colorParams, uvParams);
-		xPos += X_PAD + (uint32_t)round(static_cast<float>(sprite.width) * scale);
+        RegisterHUDElements(screen);
     }
 
-    sprite = mAsteroidsSprites.GetSprite(MISSILE_SPRITE_NAME);
-    xPos = screenWidth - mShip.AmmoLeft() * (X_PAD + sprite.width);
-
-    for (uint32_t i = 0; i < mShip.AmmoLeft(); ++i)
-    {
-        transform.pos = Vec2D(xPos, screenHeight - static_cast<float>(sprite.height) - X_PAD);
-        transform.scale = 1.0f;
-        transform.rotationAngle = 0.0f;
-
-        screen.Draw(mAsteroidsSprites, MISSILE_SPRITE_NAME, transform, colorParams, uvParams);
-        xPos += X_PAD + sprite.width;
-    }
+    screen.DrawHUDElement(mScoreHUD, static_cast<uint64_t>(mScore));
+    screen.DrawHUDElement(mLivesHUD, static_cast<uint64_t>(mLives));
+    screen.DrawHUDElement(mAmmoHUD, static_cast<uint64_t>(mShip.AmmoLeft()));
 
     if (mGameState == GAME_OVER)
     {
-		textDrawPosition = font.GetDrawPosition(GAME_OVER_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+		textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, GAME_OVER_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 
         transform.pos = textDrawPosition;
 
         colorParams.overlay = Color::Red();
 
-		screen.Draw(font, GAME_OVER_STR, transform, colorParams, uvParams);
+		screen.DrawCachedText(font, GAME_OVER_STR, transform.pos, colorParams);
     }
 
     if (mGameState == LEVEL_STARTING)
     {
         if (mLevelStartTimer <= READY_TIME_TRANSITION_THRESHOLD && mLevelStartTimer > READY_TIME_DISPLAY_THRESHOLD)
         {
-			textDrawPosition = font.GetDrawPosition(READY_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+			textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, READY_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 
             transform.pos = textDrawPosition;
             colorParams.overlay = Color::Red();
 
-			screen.Draw(font, READY_STR, transform, colorParams, uvParams);
+			screen.DrawCachedText(font, READY_STR, transform.pos, colorParams);
         }
         else if (mLevelStartTimer <= READY_TIME_DISPLAY_THRESHOLD && mLevelStartTimer > GO_TIME_TRANSITION_THRESHOLD)
         {
-			textDrawPosition = font.GetDrawPosition(READY_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+			textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, READY_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 
 			transform.pos = textDrawPosition;
 			colorParams.overlay = Color::Red();
 
-			screen.Draw(font, READY_STR, transform, colorParams, uvParams);
+			screen.DrawCachedText(font, READY_STR, transform.pos, colorParams);
         }
         else if (mLevelStartTimer <= GO_TIME_TRANSITION_THRESHOLD && mLevelStartTimer > GO_TIME_DISPLAY_THRESHOLD)
         {
-			textDrawPosition = font.GetDrawPosition(GO_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+			textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, GO_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 			
             transform.pos = textDrawPosition;
 			colorParams.overlay = Color::Red();
 
-			screen.Draw(font, GO_STR, transform, colorParams, uvParams);
+			screen.DrawCachedText(font, GO_STR, transform.pos, colorParams);
         }
         else if (mLevelStartTimer <= GO_TIME_DISPLAY_THRESHOLD)
         {
-			textDrawPosition = font.GetDrawPosition(GO_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+			textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, GO_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 
 			transform.pos = textDrawPosition;
 			colorParams.overlay = Color::Red();
 
-			screen.Draw(font, GO_STR, transform, colorParams, uvParams);
+			screen.DrawCachedText(font, GO_STR, transform.pos, colorParams);
         }
     }
 }
 
+void AsteroidsGame::RegisterHUDElements(Screen& screen)
+{
+    const float X_PAD = 1.0f;
+
+    const float screenWidth = static_cast<float>(App::Singleton().Width());
+    const float screenHeight = static_cast<float>(App::Singleton().Height());
+
+    AARectangle scoreRect = AARectangle(Vec2D(0.0f, 2.0f), static_cast<uint32_t>(screenWidth), 20);
+
+    mScoreHUD = screen.RegisterHUDElement(scoreRect, [this, screenWidth](Screen& screen, const Vec2D& origin) {
+        const auto& font = App::Singleton().GetFont();
+
+        AARectangle highScoreRect = AARectangle(Vec2D(0.0f, 2.0f), static_cast<uint32_t>(screenWidth / 2.0f), 20);
+
+        Vec2D textDrawPosition = font.GetDrawPosition(SCORE_STR, highScoreRect, BFXA_LEFT, BFYA_CENTER);
+        textDrawPosition = textDrawPosition + Vec2D(5.0f, 0.0f);
+
+        screen.Draw(font, SCORE_STR, textDrawPosition - origin);
+
+        highScoreRect = AARectangle(Vec2D(screenWidth / 2.0f, 2.0f), static_cast<uint32_t>(screenWidth / 2.0f), 20);
+
+        std::string scoreStr = std::to_string(mScore);
+
+        textDrawPosition = font.GetDrawPosition(scoreStr, highScoreRect, BFXA_RIGHT, BFYA_CENTER);
+        textDrawPosition = textDrawPosition - Vec2D(5, 0);
+
+        screen.Draw(font, scoreStr, textDrawPosition - origin);
+    });
+
+    Sprite shipSprite = mAsteroidsSprites->GetSprite(SPACE_SHIP_SPRITE_NAME);
+    AARectangle livesRect = AARectangle(Vec2D(0.0f, screenHeight - static_cast<float>(shipSprite.height)), static_cast<uint32_t>(screenWidth / 2.0f), shipSprite.height);
+
+    mLivesHUD = screen.RegisterHUDElement(livesRect, [this, shipSprite, X_PAD, screenHeight](Screen& screen, const Vec2D& origin) {
+        const float scale = 0.75f;
+        float xPos = X_PAD;
+
+        std::vector<DrawTransform> transforms;
+
+        for (int i = 0; i < mLives; ++i)
+        {
+            DrawTransform transform;
+            transform.pos = Vec2D(xPos, screenHeight - static_cast<float>(shipSprite.height)) - origin;
+            transform.scale = scale;
+
+            transforms.push_back(transform);
+            xPos += X_PAD + (uint32_t)round(static_cast<float>(shipSprite.width) * scale);
+        }
+
+        screen.DrawInstances(mAsteroidsSprites->GetBMPImage(), shipSprite, transforms, ColorParams(), UVParams());
+    });
+
+    Sprite missileSprite = mAsteroidsSprites->GetSprite(MISSILE_SPRITE_NAME);
+    AARectangle ammoRect = AARectangle(Vec2D(screenWidth / 2.0f, screenHeight - static_cast<float>(missileSprite.height) - X_PAD), static_cast<uint32_t>(screenWidth / 2.0f), missileSprite.height + static_cast<uint32_t>(X_PAD));
+
+    mAmmoHUD = screen.RegisterHUDElement(ammoRect, [this, missileSprite, X_PAD, screenWidth, screenHeight](Screen& screen, const Vec2D& origin) {
+        float xPos = screenWidth - mShip.AmmoLeft() * (X_PAD + missileSprite.width);
+
+        std::vector<DrawTransform> transforms;
+
+        for (uint32_t i = 0; i < mShip.AmmoLeft(); ++i)
+        {
+            DrawTransform transform;
+            transform.pos = Vec2D(xPos, screenHeight - static_cast<float>(missileSprite.height) - X_PAD) - origin;
+
+            transforms.push_back(transform);
+            xPos += X_PAD + missileSprite.width;
+        }
+
+        screen.DrawInstances(mAsteroidsSprites->GetBMPImage(), missileSprite, transforms, ColorParams(), UVParams());
+    });
+}
+
 void AsteroidsGame::Shutdown()
 {
 
@@ -343,7 +372,7 @@ PowerUp AsteroidsGame::MakePowerUp(AsteroidsPowerUpType type, const Vec2D& spawn
     {
 		PowerUp growPowerUp;
 
-		growPowerUp.Init(mAsteroidsSprites, "grow", spawnLocation, velocity, POWER_UP_LIFE_TIME, [this]() {
+		growPowerUp.Init(*mAsteroidsSprites, "grow", spawnLocation, velocity, POWER_UP_LIFE_TIME, [this]() {
             mShip.Grow();
 	    });
 
@@ -353,7 +382,7 @@ PowerUp AsteroidsGame::MakePowerUp(AsteroidsPowerUpType type, const Vec2D& spawn
     {
         PowerUp laserPowerUp;
 
-        laserPowerUp.Init(mAsteroidsSprites, "laser", spawnLocation, velocity, POWER_UP_LIFE_TIME, [this]() {
+        laserPowerUp.Init(*mAsteroidsSprites, "laser", spawnLocation, velocity, POWER_UP_LIFE_TIME, [this]() {
             mShip.SwitchToLaser();
         });
 
@@ -421,7 +450,7 @@ void AsteroidsGame::AddAsteroid(std::vector<Asteroid>& asteroids, const Vec2D& s
         }
 
 		Asteroid asteroid;
-		asteroid.Init(mAsteroidsSprites, name, size, spawnLocation, velocity, rotationRate);
+		asteroid.Init(*mAsteroidsSprites, name, size, spawnLocation, velocity, rotationRate);
 
         
 		asteroids.push_back(asteroid);
@@ -431,7 +460,7 @@ void AsteroidsGame::AddAsteroid(std::vector<Asteroid>& asteroids, const Vec2D& s
 
 Vec2D AsteroidsGame::GetSpawnLocation()
 {
-    Sprite largestSprite = mAsteroidsSprites.GetSprite("big_rock");
+    Sprite largestSprite = mAsteroidsSprites->GetSprite(mBigRockSpriteId);
     static std::vector<int> xSpawnLocations = {-static_cast<int>(largestSprite.width), static_cast<int>(largestSprite.width + App::Singleton().Width())};
     static std::uniform_int_distribution<size_t> xSpawnDistribution(0, xSpawnLocations.size()-1);
     static std::uniform_int_distribution<int> ySpawnDistribution(-static_cast<int>(largestSprite.height), static_cast<int>(App::Singleton().Height() + largestSprite.height));
@@ -568,7 +597,7 @@ void AsteroidsGame::PlayGame(unsigned int dt)
     }
 
     RemoveDestroyedAsteroids(dt);
-	Sprite largestSprite = mAsteroidsSprites.GetSprite("big_rock");
+	Sprite largestSprite = mAsteroidsSprites->GetSprite(mBigRockSpriteId);
 
 	Vec2D largestSpriteSize = Vec2D(static_cast<float>(largestSprite.width), static_cast<float>(largestSprite.height));
 	for (auto& asteroid : mAsteroids)
@@ -17,6 +17,7 @@
 #include "AsteroidsPowerUpTypes.h"
 #include <vector>
 #include <random>
+#include <memory>
 
 enum AsteroidsGameState
 {
@@ -29,6 +30,7 @@ class AsteroidsGame : public Game
 {
 public:
     AsteroidsGame();
+    virtual void LoadAssets(AssetLoader& loader) override;
     virtual void Init(GameController& controller) override;
     virtual void Update(unsigned int dt) override;
     virtual void Draw(Screen& screen) override;
@@ -59,11 +61,13 @@ private:
     PowerUp MakePowerUp(AsteroidsPowerUpType type, const Vec2D& spawnLocation, const Vec2D& velocity);
     void SpawnPowerUp(const Vec2D& spawnLocation, const Vec2D& velocity);
     void MaybeSpawnPowerUp(const Vec2D& spawnLocation);
+    void RegisterHUDElements(Screen& screen);
 
     AsteroidsGameState mGameState;
-    BMPImage mBGImage;
+    std::shared_ptr<const BMPImage> mBGImage;
     Ship mShip;
-    SpriteSheet mAsteroidsSprites;
+    std::shared_ptr<const SpriteSheet> mAsteroidsSprites;
+    SpriteId mBigRockSpriteId;
     std::vector<Asteroid> mAsteroids;
     std::vector<PowerUp> mPowerUps;
     std::default_random_engine mRandomGenerator;
@@ -73,6 +77,10 @@ private:
 
     int mLevelStartTimer;
 
+    uint32_t mScoreHUD;
+    uint32_t mLivesHUD;
+    uint32_t mAmmoHUD;
+
 };
 
 
@@ -23,6 +23,7 @@ Missile::Missile(const SpriteSheet& spriteSheet, const Vec2D& initialPos, const
 {
 	mSprite.Init(App::Singleton().GetBasePath() + "assets/AsteroidsAnimations.txt", spriteSheet);
 	mSprite.SetAnimation("missile", true);
+	mSpriteId = spriteSheet.GetSpriteId("missile_1");
 
 	mBoundingCircle = Circle(initialPos, mSprite.GetBoundingBox().GetWidth() / 2 - 1);
 	mBoundingCircle.MoveTo(initialPos);
@@ -36,7 +37,7 @@ void Missile::Update(uint32_t dt)
 
 void Missile::Draw(Screen& theScreen)
 {
-	const auto& sprite = mSprite.GetSpriteSheet()->GetSprite("missile_1");
+	const auto& sprite = mSprite.GetSpriteSheet()->GetSprite(mSpriteId);
 
 	mSprite.SetAngle(mYaw);
 	mSprite.SetPosition(mBoundingCircle.GetCenterPoint() - Vec2D(static_cast<float>(sprite.width) / 2.0f, static_cast<float>(sprite.height) / 2.0f) * mScale);
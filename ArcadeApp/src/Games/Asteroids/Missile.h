@@ -32,6 +32,7 @@ public:
 private:
     void DrawDebug(Screen& theScreen);
     AnimatedSprite mSprite;
+    SpriteId mSpriteId;
     Circle mBoundingCircle;
     Vec2D mVelocity;
     float mYaw;
@@ -13,7 +13,7 @@ namespace
 
 PowerUp::PowerUp()
 	: mnoptrSpriteSheet(nullptr)
-	, mSpriteName("")
+	, mSpriteId(INVALID_SPRITE_ID)
 	, mBBox()
 	, mBoundingCircle()
 	, mVelocity(Vec2D::Zero)
@@ -25,8 +25,8 @@ PowerUp::PowerUp()
 void PowerUp::Init(const SpriteSheet& spriteSheet, const std::string& spriteName, const Vec2D& initialPosition, const Vec2D& velocity, float lifetime, PowerUpEffect effect)
 {
 	mnoptrSpriteSheet = &spriteSheet;
-	mSpriteName = spriteName;
-	const auto& sprite = spriteSheet.GetSprite(spriteName);
+	mSpriteId = spriteSheet.GetSpriteId(spriteName);
+	const auto& sprite = spriteSheet.GetSprite(mSpriteId);
 	float spriteWidth = static_cast<float>(sprite.width);
 	float spriteHeight = static_cast<float>(sprite.height);
 
@@ -66,7 +66,7 @@ void PowerUp::Draw(Screen& theScreen)
 			alpha = Pulse(5.0f);
 		}
 
-		const auto& sprite = mnoptrSpriteSheet->GetSprite(mSpriteName);
+		const auto& sprite = mnoptrSpriteSheet->GetSprite(mSpriteId);
 
 		DrawTransform transform;
 		transform.pos = mBoundingCircle.GetCenterPoint() - Vec2D(roundf(static_cast<float>(sprite.width / 2)), roundf(static_cast<float>(sprite.height / 2)));
@@ -82,7 +82,7 @@ void PowerUp::Draw(Screen& theScreen)
 
 		UVParams uvParams;
 
-		theScreen.Draw(*mnoptrSpriteSheet, mSpriteName, transform, colorParams, uvParams);
+		theScreen.Draw(*mnoptrSpriteSheet, mSpriteId, transform, colorParams, uvParams);
 	}
 
 }
@@ -3,10 +3,10 @@
 
 #include "Circle.h"
 #include "AARectangle.h"
+#include "SpriteSheet.h"
 #include <functional>
 
 class Vec2D;
-class SpriteSheet;
 class Screen;
 
 class PowerUp
@@ -35,7 +35,7 @@ public:
 
 private:
 	const SpriteSheet* mnoptrSpriteSheet;
-	std::string mSpriteName;
+	SpriteId mSpriteId;
 	AARectangle mBBox;
 	Circle mBoundingCircle;
 	Vec2D mVelocity;
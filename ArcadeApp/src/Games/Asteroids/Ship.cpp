@@ -31,16 +31,25 @@ namespace
     const uint32_t LASER_USAGE_TIME = 10000; //in milliseconds
 }
 
-Ship::Ship():mShipYawMovement(SHIP_HEADING_NONE), mYaw(0), mSpeed(0), mAmmoIdGen(0), mHit(false), mDead(false), mCurrentAmmoType(ShipAmmo::Type::LASER), mGrowState(GrowState::NONE), mScaleTimer(0), mScale(1.0f), mUseLaserTimer(0)
+Ship::Ship():mShipYawMovement(SHIP_HEADING_NONE), mYaw(0), mShipSpriteId(INVALID_SPRITE_ID), mThrustersSpriteId(INVALID_SPRITE_ID), mExplosionAnimationId(INVALID_ANIMATION_ID), mThrustersAnimationId(INVALID_ANIMATION_ID), mSpeed(0), mAmmoIdGen(0), mHit(false), mDead(false), mCurrentAmmoType(ShipAmmo::Type::LASER), mGrowState(GrowState::NONE), mGrowTween(INVALID_TWEEN_HANDLE), mScale(1.0f), mUseLaserTimer(0)
 {
     
 }
 
+Ship::~Ship()
+{
+    App::Singleton().GetTweenEngine().Cancel(mGrowTween);
+}
+
 void Ship::Init(const SpriteSheet& spriteSheet, const Vec2D& initialPos)
 {
     mSprite.Init(App::Singleton().GetBasePath() + "assets/AsteroidsAnimations.txt", spriteSheet);
+    mShipSpriteId = spriteSheet.GetSpriteId("space_ship");
+    mThrustersSpriteId = spriteSheet.GetSpriteId("thrusters_1");
+    mExplosionAnimationId = mSprite.GetAnimationId("explosion");
+    mThrustersAnimationId = mSprite.GetAnimationId("thrusters");
     
-    const auto& sprite = mSprite.GetSpriteSheet()->GetSprite("space_ship");
+    const auto& sprite = spriteSheet.GetSprite(mShipSpriteId);
 
     mBoundingCircle = Circle(initialPos, roundf(sprite.width/2.0f)-4);
 }
@@ -105,68 +114,14 @@ void Ship::Update(unsigned int dt)
         mCurrentAmmoType = ShipAmmo::Type::LASER;
     }
 
-    mScale = 1.0f;
-
-    if (ALWAYS_BIG)
+    if (ALWAYS_BIG && mGrowState != GrowState::STAY)
     {
+        //Stays big for good, no timer
+        App::Singleton().GetTweenEngine().Cancel(mGrowTween);
         mGrowState = GrowState::STAY;
-    }
-
-    if (mGrowState == GrowState::GROW)
-    {
-        mScaleTimer += dt;
-
-        if (mScaleTimer >= GROW_TRANSITION_TIME)
-        {
-            mScaleTimer = GROW_TRANSITION_TIME;
-            mGrowState = GrowState::STAY;
-        }
-
-        float t = static_cast<float>(mScaleTimer) / static_cast<float>(GROW_TRANSITION_TIME);
-
-        t = ease::EaseInBounce(t);
-
-        mScale = Lerpf(1.0, GROW_SCALE, t);
-
-        if (mGrowState == GrowState::STAY)
-        {
-            mScaleTimer = STAY_BIG_SIZE_TIME;
-        }
-    }
-    else if (mGrowState == GrowState::STAY)
-    {
-        mScaleTimer -= dt;
         mScale = GROW_SCALE;
-
-        if (mScaleTimer <= 0)
-        {
-            mGrowState = GrowState::REGRESS;
-            mScaleTimer = 0;
-        }
-    }
-    else if(mGrowState == GrowState::REGRESS)
-    {
-        mScaleTimer += dt;
-
-		if (mScaleTimer >= GROW_TRANSITION_TIME)
-		{
-			mScaleTimer = GROW_TRANSITION_TIME;
-			mGrowState = GrowState::NONE;
-		}
-
-        float t = static_cast<float>(mScaleTimer) / static_cast<float>(GROW_TRANSITION_TIME);
-
-		t = ease::EaseOutBounce(t);
-
-		mScale = Lerpf(GROW_SCALE, 1.0, t);
-
-		if (mGrowState == GrowState::NONE)
-		{
-			mScaleTimer = 0;
-		}
     }
     
-    
     Vec2D heading = Vec2D(0, -1);
     heading = heading.RotationResult(mYaw);
     heading.Normalize();
@@ -196,7 +151,7 @@ void Ship::Draw(Screen& theScreen)
             ammo->Draw(theScreen);
         }
         
-        const auto& sprite = mSprite.GetSpriteSheet()->GetSprite("space_ship");
+        const auto& sprite = mSprite.GetSpriteSheet()->GetSprite(mShipSpriteId);
 
         DrawTransform transform;
         transform.pos = mBoundingCircle.GetCenterPoint() - Vec2D(round(static_cast<float>(sprite.width) / 2.0f), round(static_cast<float>(sprite.height) / 2.0f)) * mScale;
@@ -214,7 +169,7 @@ void Ship::Draw(Screen& theScreen)
 
         theScreen.Draw(
             *mSprite.GetSpriteSheet(),
-            "space_ship",
+            mShipSpriteId,
             transform,
             colorParams,
             uvParams);
@@ -226,7 +181,7 @@ void Ship::Draw(Screen& theScreen)
             heading = heading.RotationResult(mYaw);
             heading.Normalize();
            
-            const auto& thrustersSprite = mSprite.GetSpriteSheet()->GetSprite("thrusters_1");
+            const auto& thrustersSprite = mSprite.GetSpriteSheet()->GetSprite(mThrustersSpriteId);
             
             mSprite.SetScale(mScale);
             mSprite.SetAngle(mYaw);
@@ -257,9 +212,7 @@ void Ship::Respawn(const Vec2D& position)
     mShipYawMovement = SHIP_HEADING_NONE;
     mYaw = 0;
     mSpeed = 0;
-    mGrowState = GrowState::NONE;
-	mScale = 1.0f;
-	mScaleTimer = 0;
+    ResetGrowth();
 	mUseLaserTimer = 0;
 }    
 
@@ -277,8 +230,11 @@ void Ship::Grow()
 {
     if (mGrowState != GrowState::STAY)
     {
+        TweenEngine& tweens = App::Singleton().GetTweenEngine();
+
+        tweens.Cancel(mGrowTween);
 		mGrowState = GrowState::GROW;
-		mScaleTimer = 0;
+        mGrowTween = tweens.Start(&mScale, 1.0f, GROW_SCALE, GROW_TRANSITION_TIME, ease::EASE_IN_BOUNCE, OnGrown, this);
     }
     else
     {
@@ -293,19 +249,48 @@ bool Ship::IsBig()
 
 void Ship::ExtendGrow()
 {
-    if (mGrowState == GrowState::STAY)
+    if (mGrowState == GrowState::STAY && !ALWAYS_BIG)
     {
-        mScaleTimer = STAY_BIG_SIZE_TIME;
+        TweenEngine& tweens = App::Singleton().GetTweenEngine();
+
+        tweens.Cancel(mGrowTween);
+        mGrowTween = tweens.StartTimer(STAY_BIG_SIZE_TIME, OnStayBigOver, this);
     }
 }
 
 void Ship::ResetGrowth()
 {
+    App::Singleton().GetTweenEngine().Cancel(mGrowTween);
     mGrowState = GrowState::NONE;
-    mScaleTimer = 0;
     mScale = 1.0f;
 }
 
+void Ship::OnGrown(void* ship)
+{
+    Ship* grownShip = static_cast<Ship*>(ship);
+
+    grownShip->mGrowState = GrowState::STAY;
+    grownShip->mGrowTween = INVALID_TWEEN_HANDLE;
+    grownShip->ExtendGrow();
+}
+
+void Ship::OnStayBigOver(void* ship)
+{
+    Ship* bigShip = static_cast<Ship*>(ship);
+
+    bigShip->mGrowState = GrowState::REGRESS;
+    bigShip->mGrowTween = App::Singleton().GetTweenEngine().Start(&bigShip->mScale, GROW_SCALE, 1.0f, GROW_TRANSITION_TIME, ease::EASE_OUT_BOUNCE, OnRegressed, bigShip);
+}
+
+void Ship::OnRegressed(void* ship)
+{
+    Ship* regressedShip = static_cast<Ship*>(ship);
+
+    regressedShip->mGrowState = GrowState::NONE;
+    regressedShip->mGrowTween = INVALID_TWEEN_HANDLE;
+    regressedShip->mScale = 1.0f;
+}
+
 void Ship::ResetAmmoType()
 {
     mUseLaserTimer = 0;
@@ -316,7 +301,7 @@ void Ship::HitByAsteroid()
     if (!mHit && !mDead)
     {
 		mHit = true;
-		mSprite.SetAnimation("explosion", false);
+		mSprite.SetAnimation(mExplosionAnimationId, false);
 
         ResetGrowth();
         ResetAmmoType();
@@ -334,7 +319,7 @@ void Ship::EngageThrusters()
     if (!mHit && !ThrustersEngaged())
     {
         mSpeed = SHIP_SPEED;
-        mSprite.SetAnimation("thrusters", true);
+        mSprite.SetAnimation(mThrustersAnimationId, true);
     }
 }
 
@@ -13,6 +13,7 @@
 #include "AnimatedSprite.h"
 #include "Circle.h"
 #include "ShipAmmo.h"
+#include "TweenEngine.h"
 #include <memory>
 #include <vector>
 
@@ -32,6 +33,12 @@ public:
 
 
     Ship();
+    ~Ship();
+
+    //mGrowTween points at mScale and calls back with this
+    Ship(const Ship&) = delete;
+    Ship& operator=(const Ship&) = delete;
+
     void Init(const SpriteSheet& spriteSheet, const Vec2D& initialPos);
     void Update(unsigned int dt);
     void Draw(Screen& theScreen);
@@ -76,9 +83,18 @@ private:
     void ResetGrowth();
     void ResetAmmoType();
 
+    //Growth power up steps, run by the TweenEngine
+    static void OnGrown(void* ship);
+    static void OnStayBigOver(void* ship);
+    static void OnRegressed(void* ship);
+
     AsteroidsShipYawMovement mShipYawMovement;
     float mYaw; //radians
     AnimatedSprite mSprite;
+    SpriteId mShipSpriteId;
+    SpriteId mThrustersSpriteId;
+    AnimationId mExplosionAnimationId;
+    AnimationId mThrustersAnimationId;
     std::vector<std::unique_ptr<ShipAmmo>> mAmmo;
     float mSpeed;
     Circle mBoundingCircle;
@@ -100,7 +116,7 @@ private:
     //Power Ups
     float mScale;
     GrowState mGrowState;
-    int mScaleTimer;
+    TweenHandle mGrowTween; //scales mScale while growing and regressing, a timer while it stays big
 
     
     int mUseLaserTimer;
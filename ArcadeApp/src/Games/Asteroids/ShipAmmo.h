@@ -2,6 +2,7 @@
 #define __SHIP_AMMO_H__
 
 #include "Vec2D.h"
+#include <vector>
 
 class Circle;
 class Screen;
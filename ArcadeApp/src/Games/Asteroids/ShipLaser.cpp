@@ -3,10 +3,10 @@
 #include "Screen.h"
 #include "App.h"
 
-ShipLaser::ShipLaser(const Vec2D& origin, const Vec2D& velocity, const Color& color1, const Color& color2, bool cutting, ease::EasingFunc easingFunction)
+ShipLaser::ShipLaser(const Vec2D& origin, const Vec2D& velocity, const Color& color1, const Color& color2, bool cutting, ease::EasingType easing)
 	:mColor1(color1)
 	,mColor2(color2)
-	,mEasingFunc(easingFunction)
+	,mEasing(easing)
 	,mTime(0)
 	,mCutting(cutting)
 {
@@ -24,7 +24,7 @@ void ShipLaser::Draw(Screen& theScreen)
 	float t = Pulse(5);
 	Color c = Color::Lerp(mColor1, mColor2, t);
 
-	Line2D laser = mLaserRay.GetLineSegmentForTime(MillisecondsToSeconds(mTime), mEasingFunc);
+	Line2D laser = mLaserRay.GetLineSegmentForTime(MillisecondsToSeconds(mTime), mEasing);
 
 	if (mCutting)
 	{
@@ -14,7 +14,7 @@ class ShipLaser: public ShipAmmo
 {
 public:
 
-	ShipLaser(const Vec2D& origin, const Vec2D& velocity, const Color& color1, const Color& color2, bool cutting, ease::EasingFunc easingFunction = ease::EaseLinear);
+	ShipLaser(const Vec2D& origin, const Vec2D& velocity, const Color& color1, const Color& color2, bool cutting, ease::EasingType easing = ease::EASE_LINEAR);
 
 
 	virtual Type GetType() const override;
@@ -32,7 +32,7 @@ private:
 	Color mColor2;
 	uint32_t mTime;
 	bool mCutting;
-	ease::EasingFunc mEasingFunc;
+	ease::EasingType mEasing;
 };
 
 #endif // 
@@ -10,6 +10,7 @@
 #include <iostream>
 #include "GameController.h"
 #include "App.h"
+#include "AssetLoader.h"
 #include "Circle.h"
 /*
  	 Paddle
@@ -47,6 +48,20 @@
  	 	 - Reset the game
  */
 
+void BreakOut::LoadAssets(AssetLoader& loader)
+{
+	loader.Queue("BreakoutLevels.txt", [this]{
+		const std::string levelsPath = App::GetBasePath() + "assets/BreakoutLevels.txt";
+
+		mLoadedLevels = App::Singleton().GetAssetManager().Get<std::vector<BreakoutGameLevel>>(levelsPath, [levelsPath](std::vector<BreakoutGameLevel>& levels){
+			levels = BreakoutGameLevel::LoadLevelsFromFile(levelsPath);
+			return !levels.empty();
+		});
+
+		return mLoadedLevels != nullptr;
+	});
+}
+
 void BreakOut::Init(GameController& controller)
 {
 	controller.ClearAll();
@@ -223,7 +238,7 @@ void BreakOut::ResetGame(size_t toLevel)
 	float paddleWidth = static_cast<float>(Paddle::PADDLE_WIDTH);
 	float paddleHeight = static_cast<float>(Paddle::PADDLE_HEIGHT);
 
-	mLevels = BreakoutGameLevel::LoadLevelsFromFile(App::GetBasePath() + "assets/BreakoutLevels.txt");
+	mLevels = mLoadedLevels ? *mLoadedLevels : std::vector<BreakoutGameLevel>();
 	mYCutoff = screenHeight - 2*Paddle::PADDLE_HEIGHT;
 	mLives = NUM_LIVES;
 	mCurrentLevel = toLevel;
@@ -14,6 +14,7 @@
 #include "LevelBoundary.h"
 #include "BreakoutGameLevel.h"
 #include <vector>
+#include <memory>
 
 enum BreakOutGameState
 {
@@ -26,6 +27,7 @@ enum BreakOutGameState
 class BreakOut: public Game
 {
 public:
+	virtual void LoadAssets(AssetLoader& loader) override;
 	virtual void Init(GameController& controller) override;
 	virtual void Update(uint32_t dt) override;
 	virtual void Draw(Screen& screen) override;
@@ -51,6 +53,7 @@ private:
 	Ball mBall;
 	LevelBoundary mLevelBoundary;
 	std::vector<BreakoutGameLevel> mLevels;
+	std::shared_ptr<const std::vector<BreakoutGameLevel>> mLoadedLevels; //as parsed, copied into mLevels on every reset
 	size_t mCurrentLevel;
 	BreakOutGameState mGameState;
 	int mLives;
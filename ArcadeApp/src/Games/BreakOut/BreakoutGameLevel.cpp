@@ -9,6 +9,8 @@
 #include "Ball.h"
 #include "App.h"
 #include "FileCommandLoader.h"
+#include "AssetPack.h"
+#include "AssetTables.h"
 
 BreakoutGameLevel::BreakoutGameLevel()
 {
@@ -151,6 +153,10 @@ std::vector<BreakoutGameLevel> BreakoutGameLevel::LoadLevelsFromFile(const std::
 {
 	std::vector<BreakoutGameLevel> levels;
 
+	if(LoadPackedLevels(AssetPack::AssetName(filePath), levels))
+	{
+		return levels;
+	}
 
 	std::vector<LayoutBlock> layoutBlocks;
 
@@ -237,23 +243,7 @@ std::vector<BreakoutGameLevel> BreakoutGameLevel::LoadLevelsFromFile(const std::
 	 layoutCommand.commandType = COMMAND_MULTI_LINE;
 	 layoutCommand.command = "layout";
 	 layoutCommand.parseFunc = [&](ParseFuncParams params) {
-
-		 float startingX = 0;
-		 AARectangle blockRect(Vec2D(startingX, static_cast<float>((params.lineNum+1)*BLOCK_HEIGHT)), BLOCK_WIDTH, BLOCK_HEIGHT);
-
-		 for(int c = 0; c < params.line.length();++c)
-		 {
-			 if(params.line[c] != '-')
-			 {
-				 LayoutBlock layoutBlock = FindLayoutBlockForSymbol(layoutBlocks, params.line[c]);
-
-				 Block b;
-				 b.Init(blockRect, layoutBlock.hp, Color::Black(), layoutBlock.color);
-				 levelBlocks.push_back(b);
-			 }
-			 blockRect.MoveBy(Vec2D(BLOCK_WIDTH, 0));
-		 }
-
+		 AddLayoutRow(layoutBlocks, params.line.data(), params.line.length(), params.lineNum, levelBlocks);
 	 };
 
 
@@ -268,3 +258,79 @@ std::vector<BreakoutGameLevel> BreakoutGameLevel::LoadLevelsFromFile(const std::
 
 	 return levels;
 }
+
+void BreakoutGameLevel::AddLayoutRow(const std::vector<LayoutBlock>& layoutBlocks, const char* row, size_t length, uint32_t rowNum, std::vector<Block>& levelBlocks)
+{
+	float startingX = 0;
+	AARectangle blockRect(Vec2D(startingX, static_cast<float>((rowNum+1)*BLOCK_HEIGHT)), BLOCK_WIDTH, BLOCK_HEIGHT);
+
+	for(size_t c = 0; c < length; ++c)
+	{
+		if(row[c] != '-')
+		{
+			LayoutBlock layoutBlock = FindLayoutBlockForSymbol(layoutBlocks, row[c]);
+
+			Block b;
+			b.Init(blockRect, layoutBlock.hp, Color::Black(), layoutBlock.color);
+			levelBlocks.push_back(b);
+		}
+		blockRect.MoveBy(Vec2D(BLOCK_WIDTH, 0));
+	}
+}
+
+bool BreakoutGameLevel::LoadPackedLevels(const std::string& name, std::vector<BreakoutGameLevel>& levels)
+{
+	BreakoutLevelsTable table;
+
+	return FindAssetTable(name, table) && LoadLevels(table, levels);
+}
+
+bool BreakoutGameLevel::LoadLevels(const BreakoutLevelsTable& table, std::vector<BreakoutGameLevel>& levels)
+{
+	const PackedBreakoutLevelsHeader* header = &table.header;
+	const PackedBreakoutLevel* packedLevels = table.levels;
+	const PackedBreakoutBlockType* packedBlockTypes = table.blockTypes;
+	const char* rows = table.rows;
+
+	std::vector<LayoutBlock> layoutBlocks;
+	std::vector<Block> levelBlocks;
+
+	for(uint32_t i = 0; i < header->numLevels; ++i)
+	{
+		const PackedBreakoutLevel& packedLevel = packedLevels[i];
+
+		if(packedLevel.firstBlockType + packedLevel.numBlockTypes > header->numBlockTypes ||
+		   packedLevel.firstRow + packedLevel.numRows > header->numRows)
+		{
+			levels.clear();
+			return false;
+		}
+
+		layoutBlocks.clear();
+		levelBlocks.clear();
+
+		for(uint32_t b = 0; b < packedLevel.numBlockTypes; ++b)
+		{
+			const PackedBreakoutBlockType& packedBlock = packedBlockTypes[packedLevel.firstBlockType + b];
+
+			LayoutBlock lb;
+			lb.symbol = packedBlock.symbol;
+			lb.hp = packedBlock.hp;
+			lb.color = Color(packedBlock.color.r, packedBlock.color.g, packedBlock.color.b, packedBlock.color.a);
+			layoutBlocks.push_back(lb);
+		}
+
+		for(uint32_t r = 0; r < packedLevel.numRows; ++r)
+		{
+			AddLayoutRow(layoutBlocks, rows + static_cast<size_t>(packedLevel.firstRow + r) * header->rowLength, header->rowLength, r, levelBlocks);
+		}
+
+		BreakoutGameLevel level;
+		level.Init(AARectangle(Vec2D::Zero, App::Singleton().Width(), App::Singleton().Height()));
+		level.Load(levelBlocks);
+
+		levels.push_back(level);
+	}
+
+	return true;
+}
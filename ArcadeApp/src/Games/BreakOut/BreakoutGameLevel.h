@@ -16,6 +16,8 @@
 class Screen;
 class Ball;
 class AARectangle;
+struct LayoutBlock;
+struct BreakoutLevelsTable;
 
 class BreakoutGameLevel
 {
@@ -30,12 +32,24 @@ public:
 
 	bool IsLevelComplete() const;
 	static std::vector<BreakoutGameLevel> LoadLevelsFromFile(const std::string& filePath);
+	//No file I/O - from a table FindAssetTable() returned or one of the generated embedded tables
+	static bool LoadLevels(const BreakoutLevelsTable& table, std::vector<BreakoutGameLevel>& levels);
+
+	inline size_t MemorySize() const {return mBlocks.capacity() * sizeof(Block);}
 private:
 	static const int BLOCK_WIDTH = 16;
 	static const int BLOCK_HEIGHT = 8;
 	void CreateDefaultLevel(const AARectangle& boundary);
+	static bool LoadPackedLevels(const std::string& name, std::vector<BreakoutGameLevel>& levels);
+	static void AddLayoutRow(const std::vector<LayoutBlock>& layoutBlocks, const char* row, size_t length, uint32_t rowNum, std::vector<Block>& levelBlocks);
 	std::vector<Block> mBlocks;
 };
 
+//For the AssetManager's budget - the levels are cached as a std::vector<BreakoutGameLevel>
+inline size_t AssetMemorySize(const BreakoutGameLevel& level)
+{
+	return sizeof(BreakoutGameLevel) + level.MemorySize();
+}
+
 
 #endif /* GAMES_BREAKOUT_BREAKOUTGAMELEVEL_H_ */
@@ -14,11 +14,14 @@
 
 class GameController;
 class Screen;
+class AssetLoader;
 
 class Game
 {
 public:
 	virtual ~Game(){}
+	//Queue the game's sprite sheets, images and level files here instead of loading them in Init()
+	virtual void LoadAssets(AssetLoader& loader) {}
 	virtual void Init(GameController& controller) = 0;
 	virtual void Update(uint32_t dt) = 0;
 	virtual void Draw(Screen& screen) = 0;
@@ -23,6 +23,13 @@ class Actor
 {
 public:
 
+	//Ghosts live in a std::vector - keep the moves the virtual destructor would otherwise suppress
+	Actor() = default;
+	Actor(const Actor& other) = default;
+	Actor(Actor&& other) noexcept = default;
+	Actor& operator=(const Actor& other) = default;
+	Actor& operator=(Actor&& other) noexcept = default;
+
 	virtual ~Actor() {}
 	virtual void Init(const SpriteSheet& spriteSheet, const std::string& animationsPath, const Vec2D& initialPos, uint32_t movementSpeed, bool updateSpriteOnMovement, const Color&spriteColor = Color::White());
 	virtual void Update(uint32_t dt);
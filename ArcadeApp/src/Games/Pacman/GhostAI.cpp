@@ -13,6 +13,7 @@
 #include <algorithm>
 #include "Color.h"
 #include "Circle.h"
+#include "Profiler.h"
 
 namespace
 {
@@ -42,6 +43,8 @@ void GhostAI::Init(Ghost& ghost, uint32_t lookAheadDistance, const Vec2D& scatte
 
 PacmanMovement GhostAI::Update(uint32_t dt, const Pacman& pacman, const PacmanLevel& level, const std::vector<Ghost>& ghosts)
 {
+	PROFILE_ZONE("GhostAI");
+
 	if(mnoptrGhost)
 	{
 
@@ -8,6 +8,7 @@
 #include "PacmanGame.h"
 #include "App.h"
 #include "PacmanGameUtils.h"
+#include "AssetLoader.h"
 /*
  Overall Design
 
@@ -72,13 +73,25 @@ namespace
 }
 
 
+void PacmanGame::LoadAssets(AssetLoader& loader)
+{
+	const std::string& basePath = App::Singleton().GetBasePath();
+
+	loader.Load(mPacmanSpriteSheet, "PacmanSpritesPacked", {basePath + "assets/Pacman_animations.txt", basePath + "assets/Ghost_animations.txt"});
+
+	loader.Queue("Pacman_level.txt", [this, basePath]{
+		return mLevel.Load(basePath + "assets/Pacman_level.txt");
+	});
+}
+
 void PacmanGame::Init(GameController& controller)
 {
 	mReleaseGhostTimer = 0;
-	mPacmanSpriteSheet.Load("PacmanSprites");
-	mPacman.Init(mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Pacman_animations.txt", Vec2D::Zero, PACMAN_MOVEMENT_SPEED, false);
+	mScoreHUD = Screen::INVALID_HUD_ELEMENT;
+	mLivesHUD = Screen::INVALID_HUD_ELEMENT;
+	mPacman.Init(*mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Pacman_animations.txt", Vec2D::Zero, PACMAN_MOVEMENT_SPEED, false);
 
-	mLevel.Init(App::Singleton().GetBasePath() + "assets/Pacman_level.txt", &mPacmanSpriteSheet);
+	mLevel.Init(mPacmanSpriteSheet.get());
 
 
 	mStringRect = AARectangle(Vec2D(0.0f, mLevel.GetInGameTextYPos()), App::Singleton().Width(), static_cast<unsigned int>(mPacman.GetBoundingBox().GetHeight()));
@@ -240,30 +253,28 @@ void PacmanGame::Draw(Screen& screen)
 	const auto& font = App::Singleton().GetFont();
 	Vec2D textDrawPosition;
 
-	//Draw Score
-	{
-		Vec2D levelOffset = mLevel.GetLayoutOffset();
-
-		AARectangle highScoreRect = AARectangle(Vec2D(0.0f, 4.0f), App::Singleton().Width(), static_cast<unsigned int>(levelOffset.GetY()));
+	ColorParams textColorParams;
+	textColorParams.overlay = Color::Yellow();
 
-		std::string scoreStr = std::to_string(mPacman.Score());
-
-		textDrawPosition = font.GetDrawPosition(SCORE_STR + scoreStr, highScoreRect, BFXA_CENTER, BFYA_CENTER);
-
-		screen.Draw(font, SCORE_STR + scoreStr, textDrawPosition);
+	//Score and lives only get re-rendered when they change
+	if(mScoreHUD == Screen::INVALID_HUD_ELEMENT)
+	{
+		RegisterHUDElements(screen);
 	}
 
+	screen.DrawHUDElement(mScoreHUD, static_cast<uint64_t>(mPacman.Score()));
+
 	if(mGameState == LEVEL_STARTING)
 	{
-		textDrawPosition = font.GetDrawPosition(READY_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+		textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, READY_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 
-		screen.Draw(font, READY_STR, textDrawPosition, Color::Yellow());
+		screen.DrawCachedText(font, READY_STR, textDrawPosition, textColorParams);
 	}
 	else if(mGameState == GAME_OVER)
 	{
-		textDrawPosition = font.GetDrawPosition(GAME_OVER_STR, mStringRect, BFXA_CENTER, BFYA_CENTER);
+		textDrawPosition = font.GetDrawPosition(screen.GetTextRunCache().GetSizeOf(font, GAME_OVER_STR), mStringRect, BFXA_CENTER, BFYA_CENTER);
 
-		screen.Draw(font, GAME_OVER_STR, textDrawPosition, Color::Yellow());
+		screen.DrawCachedText(font, GAME_OVER_STR, textDrawPosition, textColorParams);
 	}
 
 
@@ -272,17 +283,49 @@ void PacmanGame::Draw(Screen& screen)
 
 void PacmanGame::DrawLives(Screen& screen)
 {
-	const float X_PAD = 1.0f;
+	screen.DrawHUDElement(mLivesHUD, static_cast<uint64_t>(mNumLives));
+}
 
-	auto sprite = mPacmanSpriteSheet.GetSprite(PACMAN_LIFE_SPRITE_NAME);
+void PacmanGame::RegisterHUDElements(Screen& screen)
+{
+	Vec2D levelOffset = mLevel.GetLayoutOffset();
 
-	float xPos = X_PAD;
+	AARectangle highScoreRect = AARectangle(Vec2D(0.0f, 4.0f), App::Singleton().Width(), static_cast<unsigned int>(levelOffset.GetY()));
 
-	for(int i = 0; i < mNumLives; ++i)
+	mScoreHUD = screen.RegisterHUDElement(highScoreRect, [this, highScoreRect](Screen& screen, const Vec2D& origin)
 	{
-		screen.Draw(mPacmanSpriteSheet, PACMAN_LIFE_SPRITE_NAME, Vec2D(xPos, App::Singleton().Height() - static_cast<float>(sprite.height)));
-		xPos += X_PAD + static_cast<float>(sprite.width);
-	}
+		const auto& font = App::Singleton().GetFont();
+
+		std::string scoreStr = std::to_string(mPacman.Score());
+
+		Vec2D textDrawPosition = font.GetDrawPosition(SCORE_STR + scoreStr, highScoreRect, BFXA_CENTER, BFYA_CENTER);
+
+		screen.Draw(font, SCORE_STR + scoreStr, textDrawPosition - origin);
+	});
+
+	Sprite sprite = mPacmanSpriteSheet->GetSprite(PACMAN_LIFE_SPRITE_NAME);
+
+	AARectangle livesRect = AARectangle(Vec2D(0.0f, App::Singleton().Height() - static_cast<float>(sprite.height)), App::Singleton().Width(), sprite.height);
+
+	mLivesHUD = screen.RegisterHUDElement(livesRect, [this, sprite](Screen& screen, const Vec2D& origin)
+	{
+		const float X_PAD = 1.0f;
+
+		float xPos = X_PAD;
+
+		std::vector<DrawTransform> transforms;
+
+		for(int i = 0; i < mNumLives; ++i)
+		{
+			DrawTransform transform;
+			transform.pos = Vec2D(xPos, App::Singleton().Height() - static_cast<float>(sprite.height)) - origin;
+			transforms.push_back(transform);
+
+			xPos += X_PAD + static_cast<float>(sprite.width);
+		}
+
+		screen.DrawInstances(mPacmanSpriteSheet->GetBMPImage(), sprite, transforms, ColorParams(), UVParams());
+	});
 }
 
 void PacmanGame::Shutdown()
@@ -357,7 +400,7 @@ void PacmanGame::SetupGhosts()
 	mGhostAIs.resize(NUM_GHOSTS);
 
 	Ghost blinky;
-	blinky.Init(mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[BLINKY], GHOST_MOVEMENT_SPEED, true, Color::Red());
+	blinky.Init(*mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[BLINKY], GHOST_MOVEMENT_SPEED, true, Color::Red());
 	blinky.SetMovementDirection(PACMAN_MOVEMENT_LEFT);
 	mGhosts[BLINKY] = blinky;
 
@@ -369,7 +412,7 @@ void PacmanGame::SetupGhosts()
 	mGhostAIs[BLINKY] = blinkyAI;
 
 	Ghost pinky;
-	pinky.Init(mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[PINKY], GHOST_MOVEMENT_SPEED, true, Color::Pink());
+	pinky.Init(*mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[PINKY], GHOST_MOVEMENT_SPEED, true, Color::Pink());
 	pinky.SetMovementDirection(PACMAN_MOVEMENT_DOWN);
 	mGhosts[PINKY] = pinky;
 
@@ -379,7 +422,7 @@ void PacmanGame::SetupGhosts()
 	mGhostAIs[PINKY] = pinkyAI;
 
 	Ghost inky;
-	inky.Init(mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[INKY], GHOST_MOVEMENT_SPEED, true, Color::Cyan());
+	inky.Init(*mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[INKY], GHOST_MOVEMENT_SPEED, true, Color::Cyan());
 	inky.SetMovementDirection(PACMAN_MOVEMENT_UP);
 	mGhosts[INKY] = inky;
 
@@ -389,7 +432,7 @@ void PacmanGame::SetupGhosts()
 	mGhostAIs[INKY] = inkyAI;
 
 	Ghost clyde;
-	clyde.Init(mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[CLYDE], GHOST_MOVEMENT_SPEED, true, Color::Orange());
+	clyde.Init(*mPacmanSpriteSheet, App::Singleton().GetBasePath() + "assets/Ghost_animations.txt", mLevel.GetGhostSpawnPoints()[CLYDE], GHOST_MOVEMENT_SPEED, true, Color::Orange());
 	clyde.SetMovementDirection(PACMAN_MOVEMENT_UP);
 	mGhosts[CLYDE] = clyde;
 
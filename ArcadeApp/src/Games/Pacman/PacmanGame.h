@@ -15,6 +15,7 @@
 #include "InputAction.h"
 #include "Ghost.h"
 #include "GhostAI.h"
+#include <memory>
 
 
 enum PacmanGameState
@@ -29,6 +30,7 @@ class PacmanGame: public Game
 {
 public:
 
+	virtual void LoadAssets(AssetLoader& loader) override;
 	virtual void Init(GameController& controller) override;
 	virtual void Update(uint32_t dt) override;
 	virtual void Draw(Screen& screen) override;
@@ -41,10 +43,11 @@ private:
 	void HandleGameControllerState(uint32_t dt, InputState state, PacmanMovement direction);
 	void ResetLevel();
 	void DrawLives(Screen& screen);
+	void RegisterHUDElements(Screen& screen);
 	void SetupGhosts();
 
 	PacmanMovement mPressedDirection;
-	SpriteSheet mPacmanSpriteSheet;
+	std::shared_ptr<const SpriteSheet> mPacmanSpriteSheet;
 	Pacman mPacman;
 	PacmanLevel mLevel;
 	int mNumLives;
@@ -54,6 +57,8 @@ private:
 	PacmanGameState mGameState;
 	uint32_t mLevelStartingTimer;
 	AARectangle mStringRect;
+	uint32_t mScoreHUD;
+	uint32_t mLivesHUD;
 };
 
 
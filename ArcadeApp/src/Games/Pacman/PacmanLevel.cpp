@@ -13,7 +13,10 @@
 #include "App.h"
 #include "Circle.h"
 #include "Ghost.h"
+#include "AssetPack.h"
+#include "AssetTables.h"
 #include <cassert>
+#include <cstring>
 
 namespace {
 	const uint32_t NUM_LEVELS = 256;
@@ -21,29 +24,56 @@ namespace {
 	const uint32_t SPRITE_WIDTH = 16;
 }
 
+bool PacmanLevel::Load(const std::string& levelPath)
+{
+	mGhostsSpawnPoints.resize(NUM_GHOSTS);
+
+	PacmanLevelTable table;
+	mLoaded = (FindAssetTable(AssetPack::AssetName(levelPath), table) && LoadLevel(table)) || LoadLevel(levelPath);
+
+	return mLoaded;
+}
+
+bool PacmanLevel::Load(const PacmanLevelTable& table)
+{
+	mGhostsSpawnPoints.resize(NUM_GHOSTS);
+
+	mLoaded = LoadLevel(table);
+
+	return mLoaded;
+}
+
 bool PacmanLevel::Init(const std::string& levelPath, const SpriteSheet* noptrSpriteSheet)
+{
+	Load(levelPath);
+	return Init(noptrSpriteSheet);
+}
+
+bool PacmanLevel::Init(const SpriteSheet* noptrSpriteSheet)
 {
 	mCurrentLevel = 0;
 	mnoptrSpriteSheet = noptrSpriteSheet;
 	mBonusItemSpriteName = "";
 	std::random_device r;
 	mGenerator.seed(r());
-	mGhostsSpawnPoints.resize(NUM_GHOSTS);
 
-	bool levelLoaded = LoadLevel(levelPath);
-	if(levelLoaded)
+	if(mLoaded)
 	{
 		ResetLevel();
+	}
+
+	if(mBGImage)
+	{
 
 		Sprite bgSprite;
-		bgSprite.width = mBGImage.GetWidth();
-		bgSprite.height = mBGImage.GetHeight();
+		bgSprite.width = mBGImage->GetWidth();
+		bgSprite.height = mBGImage->GetHeight();
 
-		App::Singleton().GetScreen().DrawBackground(mBGImage, bgSprite, Vec2D::Zero);
+		App::Singleton().GetScreen().DrawBackground(*mBGImage, bgSprite, Vec2D::Zero);
 
 	}
 
-	return levelLoaded;
+	return mLoaded;
 }
 
 void PacmanLevel::Update(uint32_t dt, Pacman& pacman, std::vector<Ghost>& ghosts, std::vector<GhostAI>& ghostAIs)
@@ -402,7 +432,8 @@ bool PacmanLevel::LoadLevel(const std::string& levelPath)
 	bgImageCommand.parseFunc = [this, &bgImageName](ParseFuncParams params)
 		{
 			bgImageName = FileCommandLoader::ReadString(params);
-			bool loaded = mBGImage.Load(App::Singleton().GetBasePath() + std::string("assets/") + bgImageName);
+			mBGImage = App::Singleton().GetAssetManager().GetImage(App::Singleton().GetBasePath() + std::string("assets/") + bgImageName);
+			bool loaded = mBGImage != nullptr;
 
 			assert(loaded && "Didn't load the bg image");
 		};
@@ -575,68 +606,7 @@ bool PacmanLevel::LoadLevel(const std::string& levelPath)
 	layoutCommand.commandType = COMMAND_MULTI_LINE;
 	layoutCommand.parseFunc = [&layoutOffset, this](ParseFuncParams params)
 		{
-			float startingX = layoutOffset.GetX();
-
-			for(int c = 0; c < params.line.length(); ++c)
-			{
-				Tile* tile = GetTileForSymbol(params.line[c]);
-
-				if(tile)
-				{
-					tile->position = Vec2D(startingX, layoutOffset.GetY());
-
-					if(tile->isGate > 0)
-					{
-						Excluder gate;
-
-						gate.Init(AARectangle(Vec2D(startingX, layoutOffset.GetY()), tile->width, static_cast<int>(mTileHeight)));
-
-						mGate.push_back(gate);
-					}
-					else if(tile->collidable > 0)
-					{
-						Excluder wall;
-						wall.Init(AARectangle(Vec2D(startingX, layoutOffset.GetY()), tile->width, static_cast<int>(mTileHeight)));
-
-						mWalls.push_back(wall);
-					}
-
-					if(tile->pacmanSpawnPoint > 0)
-					{
-						mPacmanSpawnLocation = Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY());
-					}
-					else if(tile->itemSpawnPoint > 0)
-					{
-						mBonusItem.bbox = AARectangle(Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY()), SPRITE_WIDTH, SPRITE_HEIGHT);
-					}
-					else if(tile->blinkySpawnPoint > 0)
-					{
-						mGhostsSpawnPoints[BLINKY] = Vec2D(startingX + tile->offset.GetX()+1, layoutOffset.GetY() + tile->offset.GetY());
-					}
-					else if(tile->pinkySpawnPoint > 0)
-					{
-						mGhostsSpawnPoints[PINKY] = Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY());
-					}
-					else if(tile->inkySpawnPoint > 0)
-					{
-						mGhostsSpawnPoints[INKY] = Vec2D(startingX + tile->offset.GetX()+1, layoutOffset.GetY() + tile->offset.GetY());
-					}
-					else if(tile->clydeSpawnPoint > 0)
-					{
-						mGhostsSpawnPoints[CLYDE] = Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY());
-					}
-
-
-					if(tile->excludePelletTile > 0)
-					{
-						mExclusionTiles.push_back(*tile);
-					}
-
-					startingX += tile->width;
-				}
-			}
-
-			layoutOffset += Vec2D(0.0f, static_cast<float>(mTileHeight));
+			AddLayoutRow(params.line.data(), params.line.length(), layoutOffset);
 		};
 
 	fileLoader.AddCommand(layoutCommand);
@@ -693,6 +663,139 @@ bool PacmanLevel::LoadLevel(const std::string& levelPath)
 	return fileLoader.LoadFile(levelPath);;
 }
 
+void PacmanLevel::AddLayoutRow(const char* row, size_t length, Vec2D& layoutOffset)
+{
+	float startingX = layoutOffset.GetX();
+
+	for(size_t c = 0; c < length; ++c)
+	{
+		Tile* tile = GetTileForSymbol(row[c]);
+
+		if(tile)
+		{
+			tile->position = Vec2D(startingX, layoutOffset.GetY());
+
+			if(tile->isGate > 0)
+			{
+				Excluder gate;
+
+				gate.Init(AARectangle(Vec2D(startingX, layoutOffset.GetY()), tile->width, static_cast<int>(mTileHeight)));
+
+				mGate.push_back(gate);
+			}
+			else if(tile->collidable > 0)
+			{
+				Excluder wall;
+				wall.Init(AARectangle(Vec2D(startingX, layoutOffset.GetY()), tile->width, static_cast<int>(mTileHeight)));
+
+				mWalls.push_back(wall);
+			}
+
+			if(tile->pacmanSpawnPoint > 0)
+			{
+				mPacmanSpawnLocation = Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY());
+			}
+			else if(tile->itemSpawnPoint > 0)
+			{
+				mBonusItem.bbox = AARectangle(Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY()), SPRITE_WIDTH, SPRITE_HEIGHT);
+			}
+			else if(tile->blinkySpawnPoint > 0)
+			{
+				mGhostsSpawnPoints[BLINKY] = Vec2D(startingX + tile->offset.GetX()+1, layoutOffset.GetY() + tile->offset.GetY());
+			}
+			else if(tile->pinkySpawnPoint > 0)
+			{
+				mGhostsSpawnPoints[PINKY] = Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY());
+			}
+			else if(tile->inkySpawnPoint > 0)
+			{
+				mGhostsSpawnPoints[INKY] = Vec2D(startingX + tile->offset.GetX()+1, layoutOffset.GetY() + tile->offset.GetY());
+			}
+			else if(tile->clydeSpawnPoint > 0)
+			{
+				mGhostsSpawnPoints[CLYDE] = Vec2D(startingX + tile->offset.GetX(), layoutOffset.GetY() + tile->offset.GetY());
+			}
+
+
+			if(tile->excludePelletTile > 0)
+			{
+				mExclusionTiles.push_back(*tile);
+			}
+
+			startingX += tile->width;
+		}
+	}
+
+	layoutOffset += Vec2D(0.0f, static_cast<float>(mTileHeight));
+}
+
+bool PacmanLevel::LoadLevel(const PacmanLevelTable& table)
+{
+	const PackedPacmanLevelHeader* header = &table.header;
+	const PackedPacmanTile* packedTiles = table.tiles;
+	const PackedBonusItem* packedBonusItems = table.bonusItems;
+	const char* layout = table.layout;
+
+	std::string bgImageName(header->bgImage, strnlen(header->bgImage, ASSET_PACK_NAME_LENGTH));
+	mBGImage = App::Singleton().GetAssetManager().GetImage(App::Singleton().GetBasePath() + std::string("assets/") + bgImageName);
+	bool loaded = mBGImage != nullptr;
+
+	assert(loaded && "Didn't load the bg image");
+
+	mTileHeight = header->tileHeight;
+	mLayoutOffset = Vec2D(header->layoutOffset.x, header->layoutOffset.y);
+
+	mTiles.reserve(header->numTiles);
+
+	for(uint32_t i = 0; i < header->numTiles; ++i)
+	{
+		const PackedPacmanTile& packed = packedTiles[i];
+
+		Tile tile;
+		tile.offset = Vec2D(packed.offset.x, packed.offset.y);
+		tile.width = packed.width;
+		tile.collidable = packed.collidable;
+		tile.isTeleportTile = packed.isTeleportTile;
+		tile.excludePelletTile = packed.excludePelletTile;
+		tile.pacmanSpawnPoint = packed.pacmanSpawnPoint;
+		tile.itemSpawnPoint = packed.itemSpawnPoint;
+		tile.blinkySpawnPoint = packed.blinkySpawnPoint;
+		tile.inkySpawnPoint = packed.inkySpawnPoint;
+		tile.pinkySpawnPoint = packed.pinkySpawnPoint;
+		tile.clydeSpawnPoint = packed.clydeSpawnPoint;
+		tile.isGate = packed.isGate;
+		tile.teleportToSymbol = packed.teleportToSymbol;
+		tile.symbol = packed.symbol;
+
+		mTiles.push_back(tile);
+	}
+
+	Vec2D layoutOffset = mLayoutOffset;
+
+	for(uint32_t r = 0; r < header->numLayoutRows; ++r)
+	{
+		const char* row = layout + static_cast<size_t>(r) * header->layoutRowLength;
+		AddLayoutRow(row, strnlen(row, header->layoutRowLength), layoutOffset);
+	}
+
+	mBonusItemProperties.reserve(header->numBonusItems);
+
+	for(uint32_t i = 0; i < header->numBonusItems; ++i)
+	{
+		const PackedBonusItem& packed = packedBonusItems[i];
+
+		BonusItemLevelProperties properties;
+		properties.spriteName = std::string(packed.spriteName, strnlen(packed.spriteName, ASSET_PACK_KEY_LENGTH));
+		properties.score = packed.score;
+		properties.begin = packed.begin;
+		properties.end = packed.end;
+
+		mBonusItemProperties.push_back(properties);
+	}
+
+	return true;
+}
+
 PacmanLevel::Tile* PacmanLevel::GetTileForSymbol(char symbol)
 {
 	for(size_t i = 0; i < mTiles.size(); ++i)
@@ -17,6 +17,7 @@
 #include "GhostAI.h"
 #include "BMPImage.h"
 #include <random>
+#include <memory>
 
 class Screen;
 class Pacman;
@@ -26,6 +27,11 @@ class PacmanLevel
 {
 public:
 
+	//Load() only parses the level file and its background so it can run on the AssetLoader
+	bool Load(const std::string& levelPath);
+	//Same without reading or parsing the level file - the table comes from FindAssetTable() or the generated embedded tables
+	bool Load(const PacmanLevelTable& table);
+	bool Init(const SpriteSheet* noptrSpriteSheet);
 	bool Init(const std::string& levelPath, const SpriteSheet* noptrSpriteSheet);
 	void Update(uint32_t dt, Pacman& pacman, std::vector<Ghost>& ghosts, std::vector<GhostAI>& ghostAIs);
 	void Draw(Screen& screen);
@@ -87,6 +93,8 @@ private:
 
 
 	bool LoadLevel(const std::string& levelPath);
+	bool LoadLevel(const PacmanLevelTable& table);
+	void AddLayoutRow(const char* row, size_t length, Vec2D& layoutOffset);
 	Tile* GetTileForSymbol(char symbol);
 	void ResetPellets();
 	bool HasEatenAllPellets() const;
@@ -95,7 +103,7 @@ private:
 	void SpawnBonusItem();
 	bool ShouldSpawnBonusItem() const;
 
-	BMPImage mBGImage;
+	std::shared_ptr<const BMPImage> mBGImage;
 	std::vector<Vec2D> mGhostsSpawnPoints;
 	std::default_random_engine mGenerator;
 	BonusItem mBonusItem;
@@ -115,6 +123,7 @@ private:
 	Vec2D mLayoutOffset;
 	uint32_t mTileHeight;
 	int mCurrentLevel;
+	bool mLoaded = false;
 };
 
 
@@ -8,6 +8,9 @@
 #include "AnimatedSprite.h"
 #include "AARectangle.h"
 #include "Screen.h"
+#include "SpriteSheet.h"
+#include "BMPImage.h"
+#include "App.h"
 
 AnimatedSprite::AnimatedSprite():mPosition(Vec2D::Zero), mnoptrSpriteSheet(nullptr), mAngle(0.0f), mScale(1.0f), mAlpha(1.0f)
 {
@@ -16,7 +19,7 @@ AnimatedSprite::AnimatedSprite():mPosition(Vec2D::Zero), mnoptrSpriteSheet(nullp
 
 void AnimatedSprite::Init(const std::string& animationsPath, const SpriteSheet& spriteSheet, const Color& color)
 {
-	mAnimationPlayer.Init(animationsPath);
+	mAnimationPlayer.Init(App::Singleton().GetAnimationLibrary().GetAnimations(animationsPath, &spriteSheet));
 	mnoptrSpriteSheet = &spriteSheet;
 	mColor = color;
 }
@@ -28,7 +31,10 @@ void AnimatedSprite::Update(uint32_t dt)
 
 void AnimatedSprite::Draw(Screen& theScreen, bool bilinearFilter, bool debug)
 {
-	AnimationFrame frame = mAnimationPlayer.GetCurrentAnimationFrame();
+	const Animation& animation = mAnimationPlayer.GetCurrentAnimation();
+	const uint32_t frameNum = mAnimationPlayer.GetCurrentFrameNumber();
+	//No copies, the records are compiled when the animation's loaded
+	const AnimationFrame& frame = animation.GetAnimationFrame(frameNum);
 
 	Color frameColor = frame.frameColor;
 
@@ -39,7 +45,7 @@ void AnimatedSprite::Draw(Screen& theScreen, bool bilinearFilter, bool debug)
 
 	if (debug)
 	{
-		printf("frame: %s, frame number: %u\n", frame.frame.c_str(), mAnimationPlayer.GetCurrentFrameNumber());
+		printf("frame: %s, frame number: %u\n", animation.GetFrameName(frameNum).c_str(), frameNum);
 	}
 
 	DrawTransform transform;
@@ -54,21 +60,58 @@ void AnimatedSprite::Draw(Screen& theScreen, bool bilinearFilter, bool debug)
 	colorParams.gradient.xParam = GradientXParam::NO_X_GRADIENT;
 	colorParams.gradient.yParam = GradientYParam::NO_Y_GRADIENT;
 
+	const bool indexed = mnoptrSpriteSheet->GetBMPImage().IsIndexed();
+
+	//Frame colors recolor indexed sheets by swapping the palette instead of multiplying every pixel
+	if(indexed)
+	{
+		colorParams.palette = mnoptrSpriteSheet->GetPaletteSwap(frameColor);
+		colorParams.overlay = Color::White();
+	}
+
 	UVParams uvParams;
 
-	theScreen.Draw(*mnoptrSpriteSheet, frame.frame, transform, colorParams, uvParams);
+	if(frame.frameId != INVALID_SPRITE_ID)
+	{
+		theScreen.Draw(*mnoptrSpriteSheet, frame.frameId, transform, colorParams, uvParams);
+	}
+	else
+	{
+		theScreen.Draw(*mnoptrSpriteSheet, animation.GetFrameName(frameNum), transform, colorParams, uvParams);
+	}
 
-	if(frame.overlay.size() > 0)
+	if(frame.hasOverlay)
 	{
 		transform.pos = mPosition;
-		colorParams.overlay = frame.overlayColor;
-		theScreen.Draw(*mnoptrSpriteSheet, frame.overlay, transform, colorParams, uvParams);
+
+		if(indexed)
+		{
+			colorParams.palette = mnoptrSpriteSheet->GetPaletteSwap(frame.overlayColor);
+		}
+		else
+		{
+			colorParams.overlay = frame.overlayColor;
+		}
+
+		if(frame.overlayId != INVALID_SPRITE_ID)
+		{
+			theScreen.Draw(*mnoptrSpriteSheet, frame.overlayId, transform, colorParams, uvParams);
+		}
+		else
+		{
+			theScreen.Draw(*mnoptrSpriteSheet, animation.OverlayName(), transform, colorParams, uvParams);
+		}
 	}
 }
 
 void AnimatedSprite::SetAnimation(const std::string& animationName, bool looped)
 {
-	if (mAnimationPlayer.Play(animationName, looped))
+	SetAnimation(mAnimationPlayer.GetAnimationId(animationName), looped);
+}
+
+void AnimatedSprite::SetAnimation(AnimationId animationId, bool looped)
+{
+	if (mAnimationPlayer.Play(animationId, looped))
 	{
 		mSize = mAnimationPlayer.GetCurrentAnimation().Size();
 	}
@@ -91,8 +134,7 @@ uint32_t AnimatedSprite::GetTotalAnimationTimeInMS() const
 {
 	if (mAnimationPlayer.HasAnimation())
 	{
-		float msPerFrame = 1000.f / static_cast<float>(mAnimationPlayer.GetCurrentAnimation().FPS());
-		return static_cast<uint32_t>(msPerFrame) * static_cast<uint32_t>(mAnimationPlayer.GetCurrentAnimation().NumFrames());
+		return mAnimationPlayer.GetCurrentAnimation().TotalDurationMS();
 	}
 
 	return 0;
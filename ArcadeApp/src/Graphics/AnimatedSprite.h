@@ -14,6 +14,7 @@
 #include "Color.h"
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 class Screen;
 class SpriteSheet;
@@ -27,6 +28,8 @@ public:
 	void Draw(Screen& theScreen, bool bilinearFilter = false, bool debug = false);
 
 	void SetAnimation(const std::string& animationName, bool looped);
+	void SetAnimation(AnimationId animationId, bool looped);
+	inline AnimationId GetAnimationId(const std::string& animationName) const {return mAnimationPlayer.GetAnimationId(animationName);}
 	void Stop();
 	const AARectangle& GetBoundingBox() const;
 
@@ -50,6 +53,7 @@ public:
 	uint32_t GetTotalAnimationTimeInMS() const;
 
 private:
+
 	const SpriteSheet * mnoptrSpriteSheet;
 	AnimationPlayer mAnimationPlayer;
 	Vec2D mPosition;
@@ -7,54 +7,101 @@
 
 #include "Animation.h"
 #include "FileCommandLoader.h"
+#include "AssetPack.h"
+#include "AssetTables.h"
 #include <cassert>
+#include <cstring>
 
-Animation::Animation(): mSize(Vec2D::Zero), mSpriteSheetName(""), mAnimationName(""), mFPS(0)
+Animation::Animation(): mSize(Vec2D::Zero), mSpriteSheetName(""), mAnimationName(""), mOverlayId(INVALID_SPRITE_ID), mFPS(0)
 {
 
 }
 
-AnimationFrame Animation::GetAnimationFrame(uint32_t frameNum) const
+const AnimationFrame& Animation::GetAnimationFrame(uint32_t frameNum) const
 {
-	AnimationFrame frame;
-
-	if(frameNum > mFrames.size())
+	if(frameNum >= mCompiledFrames.size())
 	{
-		return frame;
+		static const AnimationFrame noFrame;
+		return noFrame;
 	}
 
-	frame.frame = mFrames[frameNum];
+	return mCompiledFrames[frameNum];
+}
 
-	if(frameNum < mFrameColors.size())
+const std::string& Animation::GetFrameName(uint32_t frameNum) const
+{
+	if(frameNum >= mFrames.size())
 	{
-		frame.frameColor = mFrameColors[frameNum];
-		frame.frameColorSet = 1;
+		static const std::string noName;
+		return noName;
 	}
 
-	if(mOverlay.size() > 0)
-	{
-		frame.overlay = mOverlay;
-	}
+	return mFrames[frameNum];
+}
+
+void Animation::CompileFrames()
+{
+	mCompiledFrames.assign(mFrames.size(), AnimationFrame());
 
-	if(frameNum < mOverlayColors.size())
+	for(size_t frameNum = 0; frameNum < mCompiledFrames.size(); ++frameNum)
 	{
-		frame.overlayColor = mOverlayColors[frameNum];
+		AnimationFrame& frame = mCompiledFrames[frameNum];
+
+		if(frameNum < mFrameIds.size())
+		{
+			frame.frameId = mFrameIds[frameNum];
+		}
+
+		if(frameNum < mFrameColors.size())
+		{
+			frame.frameColor = mFrameColors[frameNum];
+			frame.frameColorSet = true;
+		}
+
+		if(mOverlay.size() > 0)
+		{
+			frame.hasOverlay = true;
+			frame.overlayId = mOverlayId;
+		}
+
+		if(frameNum < mOverlayColors.size())
+		{
+			frame.overlayColor = mOverlayColors[frameNum];
+		}
+
+		if(frameNum < mFrameOffsets.size())
+		{
+			frame.offset = mFrameOffsets[frameNum];
+		}
+
+		frame.size = mSize;
 	}
+}
 
-	if(frameNum < mFrameOffsets.size())
+void Animation::ResolveSprites(const SpriteSheet& spriteSheet)
+{
+	mFrameIds.clear();
+	mFrameIds.reserve(mFrames.size());
+
+	for(const std::string& frame : mFrames)
 	{
-		frame.offset = mFrameOffsets[frameNum];
+		mFrameIds.push_back(spriteSheet.GetSpriteId(frame));
 	}
 
-	frame.size = mSize;
+	mOverlayId = mOverlay.empty() ? INVALID_SPRITE_ID : spriteSheet.GetSpriteId(mOverlay);
 
-	return frame;
+	CompileFrames();
 }
 
 std::vector<Animation> Animation::LoadAnimations(const std::string& animationFilePath)
 {
 	std::vector<Animation> animations;
 
+	if(LoadPackedAnimations(AssetPack::AssetName(animationFilePath), animations))
+	{
+		return animations;
+	}
+
 	FileCommandLoader fileLoader;
 
 	Command animationCommand;
@@ -101,7 +148,7 @@ std::vector<Animation> Animation::LoadAnimations(const std::string& animationFil
 	framesCommand.commandType = COMMAND_MULTI_LINE;
 	framesCommand.parseFunc = [&](ParseFuncParams params)
 	{
-		animations.back().AddFrame(params.line);
+		animations.back().AddFrame(std::string(params.line));
 	};
 
 	fileLoader.AddCommand(framesCommand);
@@ -147,5 +194,86 @@ std::vector<Animation> Animation::LoadAnimations(const std::string& animationFil
 	fileLoader.AddCommand(frameOffsetsCommand);
 	
 	assert(fileLoader.LoadFile(animationFilePath));
+
+	for(Animation& animation : animations)
+	{
+		animation.CompileFrames();
+	}
+
 	return animations;
 }
+
+bool Animation::LoadPackedAnimations(const std::string& name, std::vector<Animation>& animations)
+{
+	AnimationsTable table;
+
+	return FindAssetTable(name, table) && LoadAnimations(table, animations);
+}
+
+bool Animation::LoadAnimations(const AnimationsTable& table, std::vector<Animation>& animations)
+{
+	const PackedAnimationsHeader* header = &table.header;
+	const PackedAnimation* packedAnimations = table.animations;
+	const PackedName* frameKeys = table.frameKeys;
+	const PackedColor* colors = table.colors;
+	const PackedVec2D* offsets = table.offsets;
+
+	auto ToString = [](const char* str, size_t maxLength) {
+		return std::string(str, strnlen(str, maxLength));
+	};
+
+	auto ToColor = [](const PackedColor& c) {
+		return Color(c.r, c.g, c.b, c.a);
+	};
+
+	animations.reserve(header->numAnimations);
+
+	for(uint32_t i = 0; i < header->numAnimations; ++i)
+	{
+		const PackedAnimation& packed = packedAnimations[i];
+
+		if(packed.firstFrameKey + packed.numFrameKeys > header->numFrameKeys ||
+		   packed.firstFrameColor + packed.numFrameColors > header->numColors ||
+		   packed.firstOverlayColor + packed.numOverlayColors > header->numColors ||
+		   packed.firstFrameOffset + packed.numFrameOffsets > header->numOffsets)
+		{
+			animations.clear();
+			return false;
+		}
+
+		Animation newAnimation;
+		newAnimation.SetName(ToString(packed.name, ASSET_PACK_KEY_LENGTH));
+		newAnimation.SetSpriteSheetName(ToString(packed.spriteSheet, ASSET_PACK_KEY_LENGTH));
+		newAnimation.SetOverlay(ToString(packed.overlay, ASSET_PACK_KEY_LENGTH));
+		newAnimation.SetSize(Vec2D(packed.size.x, packed.size.y));
+		newAnimation.SetFPS(packed.fps);
+
+		newAnimation.mFrames.reserve(packed.numFrameKeys);
+
+		for(uint32_t f = 0; f < packed.numFrameKeys; ++f)
+		{
+			newAnimation.AddFrame(ToString(frameKeys[packed.firstFrameKey + f].name, ASSET_PACK_KEY_LENGTH));
+		}
+
+		for(uint32_t c = 0; c < packed.numFrameColors; ++c)
+		{
+			newAnimation.AddFrameColor(ToColor(colors[packed.firstFrameColor + c]));
+		}
+
+		for(uint32_t c = 0; c < packed.numOverlayColors; ++c)
+		{
+			newAnimation.AddOverlayFrameColor(ToColor(colors[packed.firstOverlayColor + c]));
+		}
+
+		for(uint32_t o = 0; o < packed.numFrameOffsets; ++o)
+		{
+			const PackedVec2D& offset = offsets[packed.firstFrameOffset + o];
+			newAnimation.AddFrameOffset(Vec2D(offset.x, offset.y));
+		}
+
+		newAnimation.CompileFrames();
+		animations.push_back(std::move(newAnimation));
+	}
+
+	return true;
+}
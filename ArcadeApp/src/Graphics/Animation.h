@@ -10,18 +10,22 @@
 
 #include "Vec2D.h"
 #include "Color.h"
+#include "SpriteSheet.h"
 #include <string>
 #include <vector>
 
+//One frame compiled at load time - what AnimatedSprite needs to draw it without touching any strings.
+//Unresolved frames (no sheet yet) go by name, see Animation::GetFrameName() and OverlayName().
 struct AnimationFrame
 {
-	std::string frame = "";
-	std::string overlay = "";
+	SpriteId frameId = INVALID_SPRITE_ID; //set once the animation has been resolved against a sheet
+	SpriteId overlayId = INVALID_SPRITE_ID;
 	Color frameColor = Color::White();
 	Color overlayColor = Color::White();
-	Vec2D size;
+	Vec2D size = Vec2D::Zero;
 	Vec2D offset = Vec2D::Zero;
-	int frameColorSet = 0;
+	bool frameColorSet = false;
+	bool hasOverlay = false;
 };
 
 class Animation
@@ -29,7 +33,9 @@ class Animation
 public:
 	Animation();
 
-	AnimationFrame GetAnimationFrame(uint32_t frameNum) const;
+	//A default frame if frameNum is out of range
+	const AnimationFrame& GetAnimationFrame(uint32_t frameNum) const;
+	const std::string& GetFrameName(uint32_t frameNum) const;
 
 	void AddFrame(const std::string& frame) {mFrames.push_back(frame);}
 	void AddFrameColor(const Color& color) {mFrameColors.push_back(color);}
@@ -48,6 +54,9 @@ public:
 
 	void SetFPS(int fps) {mFPS = fps;}
 	int FPS() const {return mFPS;}
+	//Whole milliseconds, 0 if there's no fps
+	uint32_t FrameDurationMS() const {return mFPS > 0 ? static_cast<uint32_t>(1000 / mFPS) : 0;}
+	uint32_t TotalDurationMS() const {return FrameDurationMS() * static_cast<uint32_t>(mFrames.size());}
 
 	void SetOverlay(const std::string& overlayName) {mOverlay = overlayName;}
 	const std::string& OverlayName() const {return mOverlay;}
@@ -57,9 +66,18 @@ public:
 	size_t NumOverlayColors() const {return mOverlayColors.size();}
 	size_t NumFrameOffsets() const {return mFrameOffsets.size();}
 
+	//Looks up the frame and overlay sprites in spriteSheet so frames carry SpriteIds instead of being found by name
+	void ResolveSprites(const SpriteSheet& spriteSheet);
+	//Builds the frame records GetAnimationFrame() hands out - call once everything's been added, ResolveSprites() does too
+	void CompileFrames();
+
 	static std::vector<Animation> LoadAnimations(const std::string& animationFilePath);
+	//No file I/O - from a table FindAssetTable() returned or one of the generated embedded tables
+	static bool LoadAnimations(const AnimationsTable& table, std::vector<Animation>& animations);
 
 private:
+	static bool LoadPackedAnimations(const std::string& name, std::vector<Animation>& animations);
+
 	std::string mAnimationName;
 	std::string mSpriteSheetName;
 	std::string mOverlay;
@@ -67,6 +85,9 @@ private:
 	std::vector<Color> mFrameColors;
 	std::vector<Color> mOverlayColors;
 	std::vector<Vec2D> mFrameOffsets;
+	std::vector<SpriteId> mFrameIds;
+	std::vector<AnimationFrame> mCompiledFrames;
+	SpriteId mOverlayId;
 	Vec2D mSize;
 	int mFPS;
 };
@@ -0,0 +1,135 @@
+/*
+ * AnimationLibrary.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AnimationLibrary.h"
+#include "SpriteSheet.h"
+#include "AssetPack.h"
+
+AnimationSet::AnimationSet(std::vector<Animation> animations, const SpriteSheet* noptrSpriteSheet): mAnimations(std::move(animations))
+{
+	mAnimationIds.reserve(mAnimations.size());
+
+	for(size_t i = 0; i < mAnimations.size(); ++i)
+	{
+		if(noptrSpriteSheet)
+		{
+			mAnimations[i].ResolveSprites(*noptrSpriteSheet);
+		}
+
+		//emplace keeps the first animation with a given name, same as the old linear search did
+		mAnimationIds.emplace(mAnimations[i].GetName(), static_cast<AnimationId>(i));
+	}
+}
+
+AnimationId AnimationSet::GetAnimationId(const std::string& animationName) const
+{
+	auto iter = mAnimationIds.find(animationName);
+
+	if(iter == mAnimationIds.end())
+	{
+		return INVALID_ANIMATION_ID;
+	}
+
+	return iter->second;
+}
+
+void AnimationSet::ResolveSprites(const SpriteSheet& spriteSheet)
+{
+	for(Animation& animation : mAnimations)
+	{
+		animation.ResolveSprites(spriteSheet);
+	}
+}
+
+const AnimationSet* AnimationLibrary::GetAnimations(const std::string& animationsPath, const SpriteSheet* noptrSpriteSheet)
+{
+	auto key = std::make_pair(animationsPath, noptrSpriteSheet ? noptrSpriteSheet->GetName() : std::string());
+	std::vector<Animation> animations;
+	bool parsed = false;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto iter = mAnimationSets.find(key);
+
+		if(iter != mAnimationSets.end())
+		{
+			return iter->second->Empty() ? nullptr : iter->second.get();
+		}
+
+		auto parsedIter = mParsedAnimations.find(animationsPath);
+
+		if(parsedIter != mParsedAnimations.end())
+		{
+			animations = parsedIter->second;
+			parsed = true;
+		}
+	}
+
+	//Parse and resolve outside the lock so different files load in parallel
+	if(!parsed)
+	{
+		animations = Animation::LoadAnimations(animationsPath);
+	}
+
+	auto animationSet = std::make_unique<AnimationSet>(animations, noptrSpriteSheet);
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mParsedAnimations.emplace(animationsPath, std::move(animations));
+
+	//If another thread got here first its set is kept, nobody has seen this one yet
+	auto iter = mAnimationSets.emplace(key, std::move(animationSet)).first;
+
+	return iter->second->Empty() ? nullptr : iter->second.get();
+}
+
+size_t AnimationLibrary::NumLoadedSets() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mAnimationSets.size();
+}
+
+bool AnimationLibrary::ReloadFile(const std::string& fileName, const SpriteSheetLookup& spriteSheetLookup)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	bool reloaded = false;
+
+	for(auto& parsed : mParsedAnimations)
+	{
+		if(AssetPack::AssetName(parsed.first) != fileName)
+		{
+			continue;
+		}
+
+		parsed.second = Animation::LoadAnimations(parsed.first);
+		reloaded = true;
+
+		for(auto& animationSet : mAnimationSets)
+		{
+			if(animationSet.first.first == parsed.first)
+			{
+				const SpriteSheet* noptrSpriteSheet = animationSet.first.second.empty() ? nullptr : spriteSheetLookup(animationSet.first.second);
+				*animationSet.second = AnimationSet(parsed.second, noptrSpriteSheet);
+			}
+		}
+	}
+
+	return reloaded;
+}
+
+void AnimationLibrary::ResolveSprites(const SpriteSheet& spriteSheet)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	for(auto& animationSet : mAnimationSets)
+	{
+		if(animationSet.first.second == spriteSheet.GetName())
+		{
+			animationSet.second->ResolveSprites(spriteSheet);
+		}
+	}
+}
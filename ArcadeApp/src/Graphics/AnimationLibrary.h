@@ -0,0 +1,79 @@
+/*
+ * AnimationLibrary.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef GRAPHICS_ANIMATIONLIBRARY_H_
+#define GRAPHICS_ANIMATIONLIBRARY_H_
+
+#include "Animation.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <mutex>
+#include <functional>
+#include <stdint.h>
+
+class SpriteSheet;
+
+//Index of an animation in its AnimationSet - look it up once with GetAnimationId() and keep it
+using AnimationId = uint32_t;
+static const AnimationId INVALID_ANIMATION_ID = UINT32_MAX;
+
+//The animations of one file, only changed in place by a hot reload between frames
+class AnimationSet
+{
+public:
+	//Resolves every frame against noptrSpriteSheet when one is given
+	AnimationSet(std::vector<Animation> animations, const SpriteSheet* noptrSpriteSheet);
+
+	AnimationId GetAnimationId(const std::string& animationName) const;
+	void ResolveSprites(const SpriteSheet& spriteSheet);
+
+	inline const Animation& GetAnimation(AnimationId animationId) const {return mAnimations[animationId];}
+	inline bool IsValid(AnimationId animationId) const {return animationId < mAnimations.size();}
+	inline size_t NumAnimations() const {return mAnimations.size();}
+	inline bool Empty() const {return mAnimations.empty();}
+
+private:
+	std::vector<Animation> mAnimations;
+	std::unordered_map<std::string, AnimationId> mAnimationIds;
+};
+
+//Loads every animations file once and keeps the result for the lifetime of the app.
+//The sets never move so any number of AnimationPlayers can point at the same one, hot reloading rebuilds them in place.
+//GetAnimations() can be called from the AssetLoader's worker threads.
+class AnimationLibrary
+{
+public:
+	//Loads the file the first time it's asked for, returns nullptr if it has no animations.
+	//With a sprite sheet the frames come back with their SpriteIds resolved against it.
+	const AnimationSet* GetAnimations(const std::string& animationsPath, const SpriteSheet* noptrSpriteSheet = nullptr);
+
+	size_t NumLoadedSets() const;
+
+	//nullptr if there's no sheet by that name
+	using SpriteSheetLookup = std::function<const SpriteSheet*(const std::string& spriteSheetName)>;
+
+	//Hot reload - parses the animations file named fileName again and rebuilds its sets in place.
+	//Ids handed out stay valid as long as the animations keep their order. False if no loaded file has that name.
+	bool ReloadFile(const std::string& fileName, const SpriteSheetLookup& spriteSheetLookup);
+	//Re-resolves the frames of the sets built against a sprite sheet that was just reloaded
+	void ResolveSprites(const SpriteSheet& spriteSheet);
+
+private:
+	//Parsed once per file, then copied into a set per sprite sheet it's used with
+	std::unordered_map<std::string, std::vector<Animation>> mParsedAnimations;
+
+	//Keyed on the file and the sheet's name, unique_ptr so the sets never move
+	std::map<std::pair<std::string, std::string>, std::unique_ptr<AnimationSet>> mAnimationSets;
+
+	mutable std::mutex mMutex;
+};
+
+#endif /* GRAPHICS_ANIMATIONLIBRARY_H_ */
@@ -7,115 +7,177 @@
 
 
 #include "AnimationPlayer.h"
+#include "App.h"
 #include <cmath>
 #include <cassert>
 
-AnimationPlayer::AnimationPlayer():mTime(0), mCurrentAnimation(0), mFrame(0), mLooped(false), mIsPlaying(false), mIsFinishedPlaying(false), mHasAnimation(false)
+namespace
+{
+	AnimationSystem& Animations()
+	{
+		return App::Singleton().GetAnimationSystem();
+	}
+}
+
+AnimationPlayer::AnimationPlayer(): mHandle(INVALID_ANIMATION_HANDLE)
 {
 
 }
 
-bool AnimationPlayer::Init(const std::string& animationsPath)
+AnimationPlayer::~AnimationPlayer()
 {
-	mAnimations = Animation::LoadAnimations(animationsPath);
-	return mAnimations.size() > 0;
+	Release();
 }
 
-bool AnimationPlayer::Play(const std::string& animationName, bool looped)
+AnimationPlayer::AnimationPlayer(const AnimationPlayer& other): mHandle(INVALID_ANIMATION_HANDLE)
 {
-	bool found = false;
+	*this = other;
+}
 
-	for(size_t i = 0; i < mAnimations.size(); ++i)
+AnimationPlayer::AnimationPlayer(AnimationPlayer&& other) noexcept: mHandle(other.mHandle)
+{
+	other.mHandle = INVALID_ANIMATION_HANDLE;
+}
+
+AnimationPlayer& AnimationPlayer::operator=(const AnimationPlayer& other)
+{
+	if(this != &other)
 	{
-		if(mAnimations[i].GetName() == animationName)
+		Release();
+
+		if(other.mHandle != INVALID_ANIMATION_HANDLE)
 		{
-			mCurrentAnimation = i;
-			found = true;
-			break;
+			mHandle = Animations().Clone(other.mHandle);
 		}
 	}
 
-	if(found)
-	{
-		mIsPlaying = true;
-		mFrame = 0;
-		mTime = 0;
-		mLooped = looped;
-		mIsFinishedPlaying = false;
+	return *this;
+}
 
-		mHasAnimation = true;
+AnimationPlayer& AnimationPlayer::operator=(AnimationPlayer&& other) noexcept
+{
+	if(this != &other)
+	{
+		Release();
+		mHandle = other.mHandle;
+		other.mHandle = INVALID_ANIMATION_HANDLE;
 	}
 
-	return found;
+	return *this;
+}
+
+bool AnimationPlayer::Init(const std::string& animationsPath)
+{
+	return Init(App::Singleton().GetAnimationLibrary().GetAnimations(animationsPath));
+}
+
+bool AnimationPlayer::Init(const AnimationSet* noptrAnimations)
+{
+	Release();
+	mHandle = Animations().Create(noptrAnimations);
+	return noptrAnimations != nullptr;
+}
+
+bool AnimationPlayer::Play(const std::string& animationName, bool looped)
+{
+	return Play(GetAnimationId(animationName), looped);
+}
+
+bool AnimationPlayer::Play(AnimationId animationId, bool looped)
+{
+	return mHandle != INVALID_ANIMATION_HANDLE && Animations().Play(mHandle, animationId, looped);
 }
 
 void AnimationPlayer::Pause()
 {
-	if(mIsFinishedPlaying)
+	if(mHandle != INVALID_ANIMATION_HANDLE)
 	{
-		mIsPlaying = !mIsPlaying;
+		Animations().Pause(mHandle);
 	}
 }
 
 void AnimationPlayer::Stop()
 {
-	mIsPlaying = false;
-	mTime = 0;
-	mFrame = 0;
-	mIsFinishedPlaying = true;
+	if(mHandle != INVALID_ANIMATION_HANDLE)
+	{
+		Animations().Stop(mHandle);
+	}
 }
 
 void AnimationPlayer::Update(uint32_t dt)
 {
-	if(mIsPlaying)
+	//The frame is worked out with everyone else's in AnimationSystem::Update()
+	if(mHandle != INVALID_ANIMATION_HANDLE)
 	{
-		
-		if (mCurrentAnimation < mAnimations.size())
-		{
-			mTime += dt;
-
-			int fps = mAnimations[mCurrentAnimation].FPS();
+		Animations().AddTime(mHandle, dt);
+	}
+}
 
-			float millisecondsPerFrame = static_cast<float>(1000) / static_cast<float>(fps);
+bool AnimationPlayer::IsFinishedPlaying() const
+{
+	return mHandle != INVALID_ANIMATION_HANDLE && Animations().IsFinishedPlaying(mHandle);
+}
 
-			auto numFrames = mAnimations[mCurrentAnimation].NumFrames();
-			uint32_t totalAnimationTime = static_cast<uint32_t>( millisecondsPerFrame * numFrames );
+uint32_t AnimationPlayer::GetCurrentFrameNumber() const
+{
+	return mHandle != INVALID_ANIMATION_HANDLE ? Animations().GetFrame(mHandle) : 0;
+}
 
-			auto result = mTime % totalAnimationTime;
+bool AnimationPlayer::IsPlaying() const
+{
+	return mHandle != INVALID_ANIMATION_HANDLE && Animations().IsPlaying(mHandle);
+}
 
-			mFrame = static_cast<uint32_t>(float(result) / millisecondsPerFrame);
-			//printf("ms per frame: %f, mTime: %u\n", millisecondsPerFrame, mTime);
+bool AnimationPlayer::HasAnimation() const
+{
+	return mHandle != INVALID_ANIMATION_HANDLE && Animations().GetAnimationId(mHandle) != INVALID_ANIMATION_ID;
+}
 
-			if (mTime >= totalAnimationTime && !mLooped)
-			{
-				mIsFinishedPlaying = true;
-			}
-		}
-		
-	}
+const AnimationFrame& AnimationPlayer::GetCurrentAnimationFrame() const
+{
+	//GetCurrentAnimation() covers an id a hot reload left out of range
+	return GetCurrentAnimation().GetAnimationFrame(GetCurrentFrameNumber());
 }
 
-AnimationFrame AnimationPlayer::GetCurrentAnimationFrame() const
+const Animation& AnimationPlayer::GetCurrentAnimation() const
 {
-	assert(mHasAnimation && "We need an animation for this to work!");
+	assert(HasAnimation() && "We need an animation for this to work!");
 
-	if(mAnimations.empty())
+	const AnimationSet* noptrAnimations = Animations().GetAnimations(mHandle);
+	AnimationId animationId = Animations().GetAnimationId(mHandle);
+
+	//A hot reload can leave fewer animations than the id we hold
+	if(!noptrAnimations || !noptrAnimations->IsValid(animationId))
 	{
-		return AnimationFrame();
+		static const Animation noAnimation;
+		return noAnimation;
 	}
 
-	return mAnimations[mCurrentAnimation].GetAnimationFrame(GetCurrentFrameNumber());
+	return noptrAnimations->GetAnimation(animationId);
 }
 
+AnimationId AnimationPlayer::GetAnimationId(const std::string& animationName) const
+{
+	const AnimationSet* noptrAnimations = mHandle != INVALID_ANIMATION_HANDLE ? Animations().GetAnimations(mHandle) : nullptr;
 
+	if(!noptrAnimations)
+	{
+		return INVALID_ANIMATION_ID;
+	}
 
-const Animation& AnimationPlayer::GetCurrentAnimation() const
-{
-	assert(mHasAnimation && "We need an animation for this to work!");
-	return mAnimations[mCurrentAnimation];
+	return noptrAnimations->GetAnimationId(animationName);
 }
 
 void AnimationPlayer::PrintFrame()
 {
-	printf("Frame: %u\n", mFrame);
+	printf("Frame: %u\n", GetCurrentFrameNumber());
+}
+
+void AnimationPlayer::Release()
+{
+	if(mHandle != INVALID_ANIMATION_HANDLE)
+	{
+		Animations().Destroy(mHandle);
+		mHandle = INVALID_ANIMATION_HANDLE;
+	}
 }
@@ -10,40 +10,45 @@
 
 
 #include "Animation.h"
+#include "AnimationLibrary.h"
+#include "AnimationSystem.h"
 #include <stdint.h>
 #include <vector>
 #include <string>
 
+//Plays one animation at a time - the playback state itself is a slot in the App's AnimationSystem
 class AnimationPlayer
 {
 public:
 
 	AnimationPlayer();
+	~AnimationPlayer();
+	AnimationPlayer(const AnimationPlayer& other);
+	AnimationPlayer(AnimationPlayer&& other) noexcept;
+	AnimationPlayer& operator=(const AnimationPlayer& other);
+	AnimationPlayer& operator=(AnimationPlayer&& other) noexcept;
+
 	bool Init(const std::string& animationsPath);
+	bool Init(const AnimationSet* noptrAnimations);
 	bool Play(const std::string& animationName, bool looped);
+	bool Play(AnimationId animationId, bool looped);
 	void Pause();
 	void Stop();
 	void Update(uint32_t dt);
-	AnimationFrame GetCurrentAnimationFrame() const;
+	const AnimationFrame& GetCurrentAnimationFrame() const;
 
-	inline bool IsFinishedPlaying() const {return mIsFinishedPlaying;}
-	inline uint32_t GetCurrentFrameNumber() const {return mFrame;}
+	bool IsFinishedPlaying() const;
+	uint32_t GetCurrentFrameNumber() const;
 	const Animation& GetCurrentAnimation() const;
-	inline bool IsPlaying() const { return mIsPlaying; }
+	AnimationId GetAnimationId(const std::string& animationName) const;
+	bool IsPlaying() const;
 	void PrintFrame();
 
-	bool HasAnimation() const { return mHasAnimation; }
+	bool HasAnimation() const;
 private:
-	uint32_t mTime;
-	std::vector<Animation> mAnimations;
-	size_t mCurrentAnimation;
-	uint32_t mFrame;
-
-	bool mLooped;
-	bool mIsPlaying;
-	bool mIsFinishedPlaying;
+	void Release();
 
-	bool mHasAnimation;
+	AnimationHandle mHandle;
 };
 
 
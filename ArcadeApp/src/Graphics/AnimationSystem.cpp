@@ -0,0 +1,171 @@
+/*
+ * AnimationSystem.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AnimationSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cassert>
+
+AnimationHandle AnimationSystem::Create(const AnimationSet* noptrAnimations)
+{
+	AnimationHandle handle;
+
+	if(!mFreeHandles.empty())
+	{
+		handle = mFreeHandles.back();
+		mFreeHandles.pop_back();
+	}
+	else
+	{
+		handle = static_cast<AnimationHandle>(mTimes.size());
+
+		mTimes.push_back(0);
+		mFrames.push_back(0);
+		mFrameDurations.push_back(1);
+		mTotalDurations.push_back(1);
+		mLooped.push_back(0);
+		mPlaying.push_back(0);
+		mFinished.push_back(0);
+		mAnimationSets.push_back(nullptr);
+		mAnimationIds.push_back(INVALID_ANIMATION_ID);
+	}
+
+	Reset(handle);
+	mAnimationSets[handle] = noptrAnimations;
+
+	return handle;
+}
+
+AnimationHandle AnimationSystem::Clone(AnimationHandle handle)
+{
+	AnimationHandle clone = Create(mAnimationSets[handle]);
+
+	mTimes[clone] = mTimes[handle];
+	mFrames[clone] = mFrames[handle];
+	mFrameDurations[clone] = mFrameDurations[handle];
+	mTotalDurations[clone] = mTotalDurations[handle];
+	mLooped[clone] = mLooped[handle];
+	mPlaying[clone] = mPlaying[handle];
+	mFinished[clone] = mFinished[handle];
+	mAnimationIds[clone] = mAnimationIds[handle];
+
+	return clone;
+}
+
+void AnimationSystem::Destroy(AnimationHandle handle)
+{
+	assert(handle < mTimes.size() && "Destroying an animation handle twice?");
+
+	//Stays in the arrays so Update() can run over them without checking, it just never changes
+	Reset(handle);
+	mFreeHandles.push_back(handle);
+}
+
+bool AnimationSystem::Play(AnimationHandle handle, AnimationId animationId, bool looped)
+{
+	const AnimationSet* noptrAnimations = mAnimationSets[handle];
+	bool found = noptrAnimations && noptrAnimations->IsValid(animationId);
+
+	if(found)
+	{
+		mAnimationIds[handle] = animationId;
+		mPlaying[handle] = 1;
+		mFrames[handle] = 0;
+		mTimes[handle] = 0;
+		mLooped[handle] = looped ? 1 : 0;
+		mFinished[handle] = 0;
+
+		CacheDurations(handle);
+	}
+
+	return found;
+}
+
+void AnimationSystem::Pause(AnimationHandle handle)
+{
+	if(mFinished[handle])
+	{
+		mPlaying[handle] = !mPlaying[handle];
+	}
+}
+
+void AnimationSystem::Stop(AnimationHandle handle)
+{
+	mPlaying[handle] = 0;
+	mTimes[handle] = 0;
+	mFrames[handle] = 0;
+	mFinished[handle] = 1;
+}
+
+void AnimationSystem::AddTime(AnimationHandle handle, uint32_t dt)
+{
+	if(!mPlaying[handle] || mAnimationIds[handle] == INVALID_ANIMATION_ID)
+	{
+		return;
+	}
+
+	mTimes[handle] += dt;
+
+	//Right away rather than in Update() - games check it straight after updating their sprite
+	if(mTimes[handle] >= mTotalDurations[handle] && !mLooped[handle])
+	{
+		mFinished[handle] = 1;
+	}
+}
+
+void AnimationSystem::Update()
+{
+	PROFILE_ZONE("Anims");
+
+	const size_t numSlots = mTimes.size();
+
+	const uint32_t* times = mTimes.data();
+	const uint32_t* frameDurations = mFrameDurations.data();
+	const uint32_t* totalDurations = mTotalDurations.data();
+	uint32_t* frames = mFrames.data();
+
+	//Stopped and free slots have a time of 0 and paused ones keep theirs, so every slot can go through
+	//the same math - no branches, no float division
+	for(size_t i = 0; i < numSlots; ++i)
+	{
+		frames[i] = (times[i] % totalDurations[i]) / frameDurations[i];
+	}
+}
+
+void AnimationSystem::RefreshAnimations()
+{
+	for(AnimationHandle handle = 0; handle < mTimes.size(); ++handle)
+	{
+		const AnimationSet* noptrAnimations = mAnimationSets[handle];
+
+		if(noptrAnimations && noptrAnimations->IsValid(mAnimationIds[handle]))
+		{
+			CacheDurations(handle);
+		}
+	}
+}
+
+void AnimationSystem::CacheDurations(AnimationHandle handle)
+{
+	const Animation& animation = mAnimationSets[handle]->GetAnimation(mAnimationIds[handle]);
+
+	mFrameDurations[handle] = std::max<uint32_t>(animation.FrameDurationMS(), 1);
+	mTotalDurations[handle] = std::max<uint32_t>(animation.TotalDurationMS(), 1);
+}
+
+void AnimationSystem::Reset(AnimationHandle handle)
+{
+	mTimes[handle] = 0;
+	mFrames[handle] = 0;
+	mFrameDurations[handle] = 1;
+	mTotalDurations[handle] = 1;
+	mLooped[handle] = 0;
+	mPlaying[handle] = 0;
+	mFinished[handle] = 0;
+	mAnimationSets[handle] = nullptr;
+	mAnimationIds[handle] = INVALID_ANIMATION_ID;
+}
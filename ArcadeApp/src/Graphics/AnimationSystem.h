@@ -0,0 +1,67 @@
+/*
+ * AnimationSystem.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef GRAPHICS_ANIMATIONSYSTEM_H_
+#define GRAPHICS_ANIMATIONSYSTEM_H_
+
+#include "AnimationLibrary.h"
+#include <vector>
+#include <stdint.h>
+
+//Index of a playback slot in the AnimationSystem - what an AnimationPlayer holds
+using AnimationHandle = uint32_t;
+static const AnimationHandle INVALID_ANIMATION_HANDLE = UINT32_MAX;
+
+//Owned by the App, the playback state of every AnimationPlayer lives here in parallel arrays.
+//Players still advance their own time (games only animate what's moving), Update() then works out
+//every slot's current frame in one pass from the frame durations cached when the animation started.
+//Main thread only.
+class AnimationSystem
+{
+public:
+	AnimationHandle Create(const AnimationSet* noptrAnimations);
+	//A new slot in the same state
+	AnimationHandle Clone(AnimationHandle handle);
+	void Destroy(AnimationHandle handle);
+
+	bool Play(AnimationHandle handle, AnimationId animationId, bool looped);
+	void Pause(AnimationHandle handle);
+	void Stop(AnimationHandle handle);
+	void AddTime(AnimationHandle handle, uint32_t dt);
+
+	//Once per update tick, after the scene's update
+	void Update();
+	//Caches the frame durations again, after the animations were hot reloaded
+	void RefreshAnimations();
+
+	inline const AnimationSet* GetAnimations(AnimationHandle handle) const {return mAnimationSets[handle];}
+	inline AnimationId GetAnimationId(AnimationHandle handle) const {return mAnimationIds[handle];}
+	inline uint32_t GetFrame(AnimationHandle handle) const {return mFrames[handle];}
+	inline bool IsPlaying(AnimationHandle handle) const {return mPlaying[handle] != 0;}
+	inline bool IsFinishedPlaying(AnimationHandle handle) const {return mFinished[handle] != 0;}
+
+	inline size_t NumActive() const {return mTimes.size() - mFreeHandles.size();}
+
+private:
+	void CacheDurations(AnimationHandle handle);
+	void Reset(AnimationHandle handle);
+
+	//One entry per slot, freed slots are reused
+	std::vector<uint32_t> mTimes;
+	std::vector<uint32_t> mFrames;
+	std::vector<uint32_t> mFrameDurations; //never 0 so Update() doesn't need to check
+	std::vector<uint32_t> mTotalDurations; //never 0
+	std::vector<uint8_t> mLooped;
+	std::vector<uint8_t> mPlaying;
+	std::vector<uint8_t> mFinished;
+	std::vector<const AnimationSet*> mAnimationSets; //owned by the AnimationLibrary
+	std::vector<AnimationId> mAnimationIds;
+
+	std::vector<AnimationHandle> mFreeHandles;
+};
+
+#endif /* GRAPHICS_ANIMATIONSYSTEM_H_ */
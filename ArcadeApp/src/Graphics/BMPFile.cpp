@@ -0,0 +1,234 @@
+/*
+ * BMPFile.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "BMPFile.h"
+#include <fstream>
+#include <cstring>
+
+namespace
+{
+	const size_t BMP_FILE_HEADER_SIZE = 14;
+	const size_t BMP_INFO_HEADER_SIZE = 40;
+
+	const uint32_t BMP_RGB = 0;
+	const uint32_t BMP_BITFIELDS = 3;
+	const uint32_t BMP_ALPHABITFIELDS = 6;
+
+	uint16_t ReadLE16(const uint8_t* p)
+	{
+		return static_cast<uint16_t>(p[0] | (p[1] << 8));
+	}
+
+	uint32_t ReadLE32(const uint8_t* p)
+	{
+		return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+	}
+
+	//Only byte aligned 8-bit masks, ie. 0x00FF0000 -> 16
+	bool ByteMaskShift(uint32_t mask, uint8_t& shift)
+	{
+		for(uint8_t s = 0; s < 32; s += 8)
+		{
+			if(mask == (0xFFu << s))
+			{
+				shift = s;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+bool ReadBMPFile(const std::string& path, uint32_t& width, uint32_t& height, std::vector<Color>& pixels, std::vector<uint8_t>& indices, Palette& palette)
+{
+	std::ifstream inFile(path, std::ios::binary | std::ios::ate);
+
+	if(!inFile.is_open())
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> file(static_cast<size_t>(inFile.tellg()));
+	inFile.seekg(0);
+
+	if(!inFile.read(reinterpret_cast<char*>(file.data()), file.size()) || file.size() < BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE)
+	{
+		return false;
+	}
+
+	const uint8_t* data = file.data();
+
+	if(data[0] != 'B' || data[1] != 'M')
+	{
+		return false;
+	}
+
+	uint32_t pixelsOffset = ReadLE32(data + 10);
+	uint32_t infoHeaderSize = ReadLE32(data + 14);
+	int32_t fileWidth = static_cast<int32_t>(ReadLE32(data + 18));
+	int32_t fileHeight = static_cast<int32_t>(ReadLE32(data + 22));
+	uint16_t bitsPerPixel = ReadLE16(data + 28);
+	uint32_t compression = ReadLE32(data + 30);
+	uint32_t numPaletteColors = ReadLE32(data + 46);
+
+	if(infoHeaderSize < BMP_INFO_HEADER_SIZE || fileWidth <= 0 || fileHeight == 0 || fileHeight == INT32_MIN)
+	{
+		return false;
+	}
+
+	SourcePixelLayout layout;
+
+	if(bitsPerPixel == 32 && (compression == BMP_BITFIELDS || compression == BMP_ALPHABITFIELDS))
+	{
+		//The masks follow the info header, V4 and V5 headers have them in the same place
+		size_t masksOffset = BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE;
+		bool hasAlphaMask = compression == BMP_ALPHABITFIELDS || infoHeaderSize >= BMP_INFO_HEADER_SIZE + 16;
+
+		if(file.size() < masksOffset + (hasAlphaMask ? 16 : 12))
+		{
+			return false;
+		}
+
+		uint32_t alphaMask = hasAlphaMask ? ReadLE32(data + masksOffset + 12) : 0;
+
+		if(!ByteMaskShift(ReadLE32(data + masksOffset), layout.rShift) ||
+		   !ByteMaskShift(ReadLE32(data + masksOffset + 4), layout.gShift) ||
+		   !ByteMaskShift(ReadLE32(data + masksOffset + 8), layout.bShift) ||
+		   (alphaMask != 0 && !ByteMaskShift(alphaMask, layout.aShift)))
+		{
+			return false;
+		}
+
+		layout.hasAlpha = alphaMask != 0;
+	}
+	else if(compression != BMP_RGB || (bitsPerPixel != 8 && bitsPerPixel != 24 && bitsPerPixel != 32))
+	{
+		return false;
+	}
+
+	const bool bottomUp = fileHeight > 0;
+	const uint32_t imageWidth = static_cast<uint32_t>(fileWidth);
+	const uint32_t imageHeight = static_cast<uint32_t>(bottomUp ? fileHeight : -fileHeight);
+
+	//Every row is padded to 4 bytes
+	const size_t pitch = ((static_cast<size_t>(imageWidth) * bitsPerPixel + 31) / 32) * 4;
+
+	if(pixelsOffset > file.size() || pitch * imageHeight > file.size() - pixelsOffset)
+	{
+		return false;
+	}
+
+	const uint8_t* pixelData = data + pixelsOffset;
+
+	auto SourceRow = [&](uint32_t r) {
+		return pixelData + pitch * (bottomUp ? imageHeight - 1 - r : r);
+	};
+
+	width = imageWidth;
+	height = imageHeight;
+	pixels.clear();
+	indices.clear();
+	palette.clear();
+
+	const size_t numPixels = static_cast<size_t>(width) * height;
+
+	if(bitsPerPixel == 8)
+	{
+		if(numPaletteColors == 0 || numPaletteColors > BMPImage::MAX_PALETTE_SIZE)
+		{
+			numPaletteColors = BMPImage::MAX_PALETTE_SIZE;
+		}
+
+		size_t paletteOffset = BMP_FILE_HEADER_SIZE + infoHeaderSize;
+
+		if(paletteOffset + numPaletteColors * 4 > file.size())
+		{
+			return false;
+		}
+
+		//BGRX entries, the X byte isn't alpha
+		palette.reserve(BMPImage::MAX_PALETTE_SIZE);
+
+		for(uint32_t i = 0; i < numPaletteColors; ++i)
+		{
+			const uint8_t* entry = data + paletteOffset + i * 4;
+			palette.push_back(Color(entry[2], entry[1], entry[0], 255));
+		}
+
+		indices.resize(numPixels);
+
+		uint8_t maxIndex = 0;
+
+		for(uint32_t r = 0; r < height; ++r)
+		{
+			const uint8_t* row = SourceRow(r);
+			memcpy(&indices[r * width], row, width);
+
+			for(uint32_t c = 0; c < width; ++c)
+			{
+				maxIndex = row[c] > maxIndex ? row[c] : maxIndex;
+			}
+		}
+
+		//Out of range indices are black rather than reading past the palette
+		if(maxIndex >= palette.size())
+		{
+			palette.resize(static_cast<size_t>(maxIndex) + 1, Color::Black());
+		}
+	}
+	else if(bitsPerPixel == 24)
+	{
+		pixels.resize(numPixels);
+
+		layout.hasAlpha = false;
+
+		std::vector<uint8_t> rowPixels(static_cast<size_t>(width) * 4, 0);
+
+		for(uint32_t r = 0; r < height; ++r)
+		{
+			const uint8_t* row = SourceRow(r);
+
+			//Widen BGR to BGRX so the row goes through the same conversion as 32-bit files
+			for(uint32_t c = 0; c < width; ++c)
+			{
+				memcpy(&rowPixels[c * 4], row + c * 3, 3);
+			}
+
+			Color::ConvertPixels(rowPixels.data(), width, layout, &pixels[r * width]);
+		}
+	}
+	else
+	{
+		pixels.resize(numPixels);
+
+		//Plain 32-bit files don't say whether the 4th byte is alpha - same as SDL, treat it as alpha unless it's all 0
+		if(compression == BMP_RGB)
+		{
+			uint8_t anyAlpha = 0;
+
+			for(uint32_t r = 0; r < height && anyAlpha == 0; ++r)
+			{
+				const uint8_t* row = SourceRow(r);
+
+				for(uint32_t c = 0; c < width; ++c)
+				{
+					anyAlpha |= row[c * 4 + 3];
+				}
+			}
+
+			layout.hasAlpha = anyAlpha != 0;
+		}
+
+		for(uint32_t r = 0; r < height; ++r)
+		{
+			Color::ConvertPixels(SourceRow(r), width, layout, &pixels[r * width]);
+		}
+	}
+
+	return true;
+}
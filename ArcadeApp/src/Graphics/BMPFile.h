@@ -0,0 +1,20 @@
+/*
+ * BMPFile.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef GRAPHICS_BMPFILE_H_
+#define GRAPHICS_BMPFILE_H_
+
+#include "BMPImage.h"
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+//The reader BMPImage loads a .bmp with, no SDL and no App so the tools can use it too. Uncompressed
+//8, 24 and 32 bit files only, false for anything else. 8-bit files fill indices and palette, the rest pixels
+bool ReadBMPFile(const std::string& path, uint32_t& width, uint32_t& height, std::vector<Color>& pixels, std::vector<uint8_t>& indices, Palette& palette);
+
+#endif /* GRAPHICS_BMPFILE_H_ */
@@ -7,14 +7,141 @@
 
 
 #include "BMPImage.h"
+#include "BMPFile.h"
+#include "AssetPack.h"
+#include "AssetTables.h"
+#include "ImageCodec.h"
+#include "App.h"
 #include <SDL2/SDL.h>
+#include <unordered_map>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <cstring>
 
-BMPImage::BMPImage():mWidth(0), mHeight(0)
+BMPImage::BMPImage():mnoptrPackedIndices(nullptr), mWidth(0), mHeight(0)
 {
 
 }
 
 bool BMPImage::Load(const std::string& path)
+{
+	ImageTable table;
+
+	if(FindAssetTable(AssetPack::AssetName(path), table) && Load(table))
+	{
+		return true;
+	}
+
+	//SDL is only needed for the compressed and 16-bit files the reader doesn't handle
+	if(!LoadCompressedFile(path) && !LoadBMPFile(path) && !LoadBMPSurface(path))
+	{
+		return false;
+	}
+
+	if(!IsIndexed())
+	{
+		QuantizeToPalette();
+	}
+
+	return true;
+}
+
+bool BMPImage::LoadBMPFile(const std::string& path)
+{
+	std::vector<Color> pixels;
+	std::vector<uint8_t> indices;
+	Palette palette;
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	if(!ReadBMPFile(path, width, height, pixels, indices, palette))
+	{
+		return false;
+	}
+
+	Clear();
+	mPixels = std::move(pixels);
+	mIndices = std::move(indices);
+	mPalette = std::move(palette);
+	mWidth = width;
+	mHeight = height;
+
+	return true;
+}
+
+bool BMPImage::LoadCompressedFile(const std::string& path)
+{
+	size_t extensionPos = path.find_last_of('.');
+
+	if(extensionPos == std::string::npos || path.find_first_of("/\\", extensionPos) != std::string::npos)
+	{
+		return false;
+	}
+
+	const std::string compressedPath = path.substr(0, extensionPos) + COMPRESSED_IMAGE_EXTENSION;
+
+	std::error_code error;
+	const std::filesystem::file_time_type compressedTime = std::filesystem::last_write_time(compressedPath, error);
+
+	if(error)
+	{
+		return false;
+	}
+
+	//A .bmp saved after the .aimg was made wins - the .aimg is out of date until ImageCompressor runs again
+	const std::filesystem::file_time_type sourceTime = std::filesystem::last_write_time(path, error);
+
+	if(!error && sourceTime > compressedTime)
+	{
+		std::cout << compressedPath << " is older than " << path << ", loading the .bmp - rerun ImageCompressor" << std::endl;
+		return false;
+	}
+
+	std::ifstream inFile(compressedPath, std::ios::binary | std::ios::ate);
+
+	if(!inFile.is_open())
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> file(static_cast<size_t>(inFile.tellg()));
+	inFile.seekg(0);
+
+	CompressedImageView image;
+
+	if(!inFile.read(reinterpret_cast<char*>(file.data()), file.size()) || !image.Open(file.data(), file.size()))
+	{
+		return false;
+	}
+
+	Clear();
+	mWidth = image.Width();
+	mHeight = image.Height();
+	mPixels.resize(static_cast<size_t>(mWidth) * mHeight);
+
+	SourcePixelLayout layout; //RGBA in memory
+	layout.rShift = 0;
+	layout.gShift = 8;
+	layout.bShift = 16;
+	layout.aShift = 24;
+
+	//Chunks cover separate rows so each thread converts straight into its own part of mPixels
+	bool decoded = DecodeImage(image, &App::Singleton().GetThreadPool(), [this, &layout](uint32_t firstRow, uint32_t numRows, const uint8_t* rgba){
+		Color::ConvertPixels(rgba, static_cast<size_t>(numRows) * mWidth, layout, &mPixels[static_cast<size_t>(firstRow) * mWidth]);
+	});
+
+	if(!decoded)
+	{
+		std::cout << "Corrupt compressed image next to: " << path << std::endl;
+		Clear();
+		return false;
+	}
+
+	return true;
+}
+
+bool BMPImage::LoadBMPSurface(const std::string& path)
 {
 	SDL_Surface * bmpSurface = SDL_LoadBMP(path.c_str());
 
@@ -23,24 +150,144 @@ bool BMPImage::Load(const std::string& path)
 		return false;
 	}
 
-	mWidth = bmpSurface->w;
-	mHeight = bmpSurface->h;
+	//Whatever the file's format was, read it back as 32-bit ARGB
+	SDL_Surface * argbSurface = SDL_ConvertSurfaceFormat(bmpSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+	SDL_FreeSurface(bmpSurface);
 
-	uint32_t lengthOfFile = mWidth * mHeight;
+	if(argbSurface == nullptr)
+	{
+		return false;
+	}
+
+	Clear();
+	mWidth = argbSurface->w;
+	mHeight = argbSurface->h;
+	mPixels.resize(static_cast<size_t>(mWidth) * mHeight);
 
-	mPixels.reserve(lengthOfFile);
+	SourcePixelLayout layout; //ARGB8888 is BGRA in memory
 
-	SDL_LockSurface(bmpSurface);
+	SDL_LockSurface(argbSurface);
 
-	uint32_t * pixels = static_cast<uint32_t*>(bmpSurface->pixels);
+	const uint8_t* rows = static_cast<const uint8_t*>(argbSurface->pixels);
 
-	for(uint32_t i = 0; i < lengthOfFile; ++i)
+	for(uint32_t r = 0; r < mHeight; ++r)
 	{
-		mPixels.push_back(Color(pixels[i]));
+		Color::ConvertPixels(rows + r * argbSurface->pitch, mWidth, layout, &mPixels[r * mWidth]);
 	}
-	SDL_UnlockSurface(bmpSurface);
-	SDL_FreeSurface(bmpSurface);
+
+	SDL_UnlockSurface(argbSurface);
+	SDL_FreeSurface(argbSurface);
 
 	return true;
 }
 
+void BMPImage::Clear()
+{
+	mPixels.clear();
+	mIndices.clear();
+	mPalette.clear();
+	mnoptrPackedIndices = nullptr;
+	mWidth = 0;
+	mHeight = 0;
+}
+
+bool BMPImage::Load(const ImageTable& table)
+{
+	const PackedImage& packedImage = table.image;
+	size_t numPixels = static_cast<size_t>(packedImage.width) * packedImage.height;
+
+	if(packedImage.paletteSize > MAX_PALETTE_SIZE || (packedImage.paletteSize > 0 ? table.palette == nullptr || table.indices == nullptr : table.pixels == nullptr))
+	{
+		return false;
+	}
+
+	mWidth = packedImage.width;
+	mHeight = packedImage.height;
+
+	mPixels.clear();
+	mIndices.clear();
+	mIndices.shrink_to_fit();
+	mPalette.clear();
+	mnoptrPackedIndices = nullptr;
+
+	if(packedImage.paletteSize > 0)
+	{
+		//The palette has to be converted to the screen's pixel format, the indices are used as is
+		mPalette.reserve(packedImage.paletteSize);
+
+		for(uint32_t i = 0; i < packedImage.paletteSize; ++i)
+		{
+			mPalette.push_back(Color(table.palette[i].r, table.palette[i].g, table.palette[i].b, table.palette[i].a));
+		}
+
+		mnoptrPackedIndices = table.indices;
+	}
+	else
+	{
+		mPixels.reserve(numPixels);
+
+		for(size_t i = 0; i < numPixels; ++i)
+		{
+			mPixels.push_back(Color(table.pixels[i].r, table.pixels[i].g, table.pixels[i].b, table.pixels[i].a));
+		}
+	}
+
+	return true;
+}
+
+Palette BMPImage::ModulatePalette(const Palette& palette, const Color& overlay)
+{
+	Palette result;
+	result.reserve(palette.size());
+
+	for(const Color& c : palette)
+	{
+		result.push_back(Color(
+			static_cast<uint8_t>((c.GetRed() * overlay.GetRed()) / 255),
+			static_cast<uint8_t>((c.GetGreen() * overlay.GetGreen()) / 255),
+			static_cast<uint8_t>((c.GetBlue() * overlay.GetBlue()) / 255),
+			static_cast<uint8_t>((c.GetAlpha() * overlay.GetAlpha()) / 255)));
+	}
+
+	return result;
+}
+
+bool BMPImage::QuantizeToPalette()
+{
+	//Only lossless - if the image uses more than 256 distinct colors we keep it as is
+	std::unordered_map<uint32_t, uint8_t> colorToIndex;
+	Palette palette;
+	std::vector<uint8_t> indices;
+	indices.reserve(mPixels.size());
+
+	for(const Color& c : mPixels)
+	{
+		auto iter = colorToIndex.find(c.GetPixelColor());
+
+		if(iter == colorToIndex.end())
+		{
+			if(palette.size() == MAX_PALETTE_SIZE)
+			{
+				return false;
+			}
+
+			uint8_t index = static_cast<uint8_t>(palette.size());
+			colorToIndex.emplace(c.GetPixelColor(), index);
+			palette.push_back(c);
+			indices.push_back(index);
+		}
+		else
+		{
+			indices.push_back(iter->second);
+		}
+	}
+
+	mPalette = std::move(palette);
+	mIndices = std::move(indices);
+	mnoptrPackedIndices = nullptr;
+
+	mPixels.clear();
+	mPixels.shrink_to_fit();
+
+	return true;
+}
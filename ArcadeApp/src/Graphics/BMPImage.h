@@ -13,21 +13,54 @@
 #include <string>
 #include <stdint.h>
 
+struct ImageTable;
+
+//Up to 256 colors that the indices of an indexed image refer to
+using Palette = std::vector<Color>;
 
 class BMPImage
 {
 public:
 
+	static const size_t MAX_PALETTE_SIZE = 256;
+
 	BMPImage();
 	bool Load(const std::string& path);
+	//Uses a pre-converted image from the asset pack or the embedded tables, the indices are read in place
+	bool Load(const ImageTable& table);
+
+	//Returns a copy of palette with every entry multiplied by overlay - used for palette swaps
+	static Palette ModulatePalette(const Palette& palette, const Color& overlay);
 
 	inline const std::vector<Color>& GetPixels() const {return mPixels;}
 	inline uint32_t GetWidth() const {return mWidth;}
 	inline uint32_t GetHeight() const {return mHeight;}
 
+	//Indexed (8-bit) images store one byte per pixel plus a palette, GetPixels() is empty for them
+	inline bool IsIndexed() const {return !mPalette.empty();}
+	inline const uint8_t* GetIndices() const {return mnoptrPackedIndices ? mnoptrPackedIndices : mIndices.data();}
+	inline const Palette& GetPalette() const {return mPalette;}
+
+	inline size_t NumPixels() const {return IsIndexed() ? static_cast<size_t>(mWidth) * mHeight : mPixels.size();}
+	inline const Color& GetPixel(size_t index) const {return IsIndexed() ? mPalette[GetIndices()[index]] : mPixels[index];}
+
+	//Bytes on the heap - indices read in place from the asset pack don't count
+	inline size_t MemorySize() const {return mPixels.size() * sizeof(Color) + mIndices.size() + mPalette.size() * sizeof(Color);}
+
 private:
 
+	//Reads the .aimg next to the .bmp if Tools/ImageCompressor made one and the .bmp hasn't been saved since
+	bool LoadCompressedFile(const std::string& path);
+	//Uncompressed 8, 24 and 32 bit files read without SDL, false for anything else
+	bool LoadBMPFile(const std::string& path);
+	bool LoadBMPSurface(const std::string& path);
+	void Clear();
+	bool QuantizeToPalette();
+
 	std::vector<Color> mPixels;
+	std::vector<uint8_t> mIndices;
+	const uint8_t* mnoptrPackedIndices; //points into the asset table instead of mIndices when loaded from one
+	Palette mPalette;
 	uint32_t mWidth;
 	uint32_t mHeight;
 };
@@ -9,46 +9,98 @@
 #include "AARectangle.h"
 #include "Vec2D.h"
 #include <iostream>
+#include <cassert>
 
 bool BitmapFont::Load(const std::string& name)
 {
-	return mFontSheet.Load(name);
+	bool loaded = mFontSheet.Load(name);
+
+	BuildGlyphTable();
+
+	return loaded;
 }
 
 Size BitmapFont::GetSizeOf(const std::string & str) const
 {
 	Size textSize;
 
-	size_t length = str.length();
+	for(char c : str)
+	{
+		const BitmapFontGlyph& glyph = GetGlyph(c);
 
-	int i = 0;
+		textSize.height = textSize.height < glyph.sprite.height ? glyph.sprite.height : textSize.height;
+		textSize.width += glyph.advance;
+	}
 
-	for(char c : str)
+	//A single character has always measured without its trailing letter spacing - the centred one glyph
+	//labels are laid out on that, longer strings keep it
+	if(str.length() == 1 && str[0] != ' ')
 	{
-		if(c == ' ')
-		{
-			textSize.width += GetFontSpacingBetweenWords();
+		textSize.width -= GetFontSpacingBetweenLetters();
+	}
+
+	return textSize;
+}
+
+void BitmapFont::BuildGlyphTable()
+{
+	//Unknown characters take no space but still get the letter spacing, same as an empty sprite would
+	for(BitmapFontGlyph& glyph : mGlyphs)
+	{
+		glyph.sprite = Sprite();
+		glyph.advance = GetFontSpacingBetweenLetters();
+	}
+
+	//By index - looking the sprite up by name is case insensitive and would hand 'a' the 'A' sprite
+	const std::vector<std::string> spriteNames = mFontSheet.SpriteNames();
+	bool inSheet[256] = {};
+
+	for(size_t i = 0; i < spriteNames.size(); ++i)
+	{
+		const std::string& spriteName = spriteNames[i];
+		const uint8_t c = static_cast<uint8_t>(spriteName[0]);
 
+		//The first sprite with a name wins, same as GetSpriteId()
+		if(spriteName.length() != 1 || inSheet[c])
+		{
 			continue;
 		}
 
-		Sprite sprite = mFontSheet.GetSprite(std::string("") + c);
-		textSize.height = textSize.height < sprite.height ? sprite.height : textSize.height;
-		textSize.width += sprite.width;
+		inSheet[c] = true;
+
+		BitmapFontGlyph& glyph = mGlyphs[c];
+		glyph.sprite = mFontSheet.GetSprite(static_cast<SpriteId>(i));
+		glyph.advance = glyph.sprite.width + GetFontSpacingBetweenLetters();
+	}
+
+	//The font only has upper case letters - lower case falls back to them unless the sheet has its own
+	for(char c = 'a'; c <= 'z'; ++c)
+	{
+		BitmapFontGlyph& glyph = mGlyphs[static_cast<uint8_t>(c)];
 
-		if(i + 1 < length)
+		if(!inSheet[static_cast<uint8_t>(c)])
+		{
+			glyph = mGlyphs[static_cast<uint8_t>(c - 'a' + 'A')];
+		}
+		else
 		{
-			textSize.width += GetFontSpacingBetweenLetters();
+			const Sprite& upper = mGlyphs[static_cast<uint8_t>(c - 'a' + 'A')].sprite;
+			assert(!inSheet[static_cast<uint8_t>(c - 'a' + 'A')] || glyph.sprite.xPos != upper.xPos || glyph.sprite.yPos != upper.yPos);
 		}
 	}
 
-	return textSize;
+	BitmapFontGlyph& space = mGlyphs[static_cast<uint8_t>(' ')];
+	space.sprite = Sprite();
+	space.advance = GetFontSpacingBetweenWords();
 }
 
 Vec2D BitmapFont::GetDrawPosition(const std::string& str, const AARectangle& box, BitmapFontXAlignment xAlign, BitmapFontYAlignment yAlign) const
 {
-	Size textSize = GetSizeOf(str);
+	return GetDrawPosition(GetSizeOf(str), box, xAlign, yAlign);
+}
 
+Vec2D BitmapFont::GetDrawPosition(const Size& textSize, const AARectangle& box, BitmapFontXAlignment xAlign, BitmapFontYAlignment yAlign) const
+{
 	float textSizeWidth = static_cast<float>(textSize.width);
 	float textSizeHeight = static_cast<float>(textSize.height);
 
@@ -11,6 +11,7 @@
 #include "SpriteSheet.h"
 #include "Utils.h"
 #include <stdint.h>
+#include <array>
 
 class Vec2D;
 class AARectangle;
@@ -29,6 +30,12 @@ enum BitmapFontYAlignment
 	BFYA_BOTTOM
 };
 
+struct BitmapFontGlyph
+{
+	Sprite sprite;
+	uint32_t advance = 0; //how far the pen moves after this character, spacing included
+};
+
 class BitmapFont
 {
 public:
@@ -37,13 +44,20 @@ public:
 	bool Load(const std::string& name);
 	Size GetSizeOf(const std::string & str) const;
 	Vec2D GetDrawPosition(const std::string& str, const AARectangle& box, BitmapFontXAlignment xAlign = BFXA_LEFT, BitmapFontYAlignment yAlign = BFYA_TOP) const;
+	Vec2D GetDrawPosition(const Size& textSize, const AARectangle& box, BitmapFontXAlignment xAlign = BFXA_LEFT, BitmapFontYAlignment yAlign = BFYA_TOP) const;
+
+	inline const BitmapFontGlyph& GetGlyph(char c) const {return mGlyphs[static_cast<uint8_t>(c)];}
 
 	inline const SpriteSheet& GetSpriteSheet() const {return mFontSheet;}
 	inline const uint32_t GetFontSpacingBetweenLetters() const {return 2;}
 	inline const uint32_t GetFontSpacingBetweenWords() const {return 5;}
 
 private:
+
+	void BuildGlyphTable();
+
 	SpriteSheet mFontSheet;
+	std::array<BitmapFontGlyph, 256> mGlyphs;
 };
 
 #endif /* GRAPHICS_BITMAPFONT_H_ */
@@ -8,6 +8,13 @@
 #include "Color.h"
 #include <SDL2/SDL.h>
 #include "Utils.h"
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COLOR_USE_SSE2
+#include <emmintrin.h>
+#endif
 
 const SDL_PixelFormat* Color::mFormat = nullptr;
 void Color::InitColorFormat(const SDL_PixelFormat * format)
@@ -78,7 +85,7 @@ Color Color::Evaluate1MinusSourceAlpha(const Color& source, const Color& destina
 
 	float sourceAlpha = float(alpha) / 255.0f;
 	
-    Color newColor = Color::Lerp(destination, source, sourceAlpha, ease::EaseLinear);
+    Color newColor = Color::Lerp(destination, source, sourceAlpha);
     newColor.SetAlpha(255);
 
 	return newColor;
@@ -86,13 +93,7 @@ Color Color::Evaluate1MinusSourceAlpha(const Color& source, const Color& destina
 
 Color Color::Lerp(const Color& c1, const Color& c2, float t)
 {
-	return Lerp(c1, c2, t, ease::EaseLinear);
-}
-
-Color Color::Lerp(const Color& c1, const Color& c2, float t, ease::EasingFunc func)
-{
-	t = func(t);
-
+	//Linear - no easing call, this runs per blended pixel
 	uint8_t r = Clamp8(static_cast<uint8_t>(Lerpf(c1.GetRed(), c2.GetRed(), t)), 0, 255);
 	uint8_t g = Clamp8(static_cast<uint8_t>(Lerpf(c1.GetGreen(), c2.GetGreen(), t)), 0, 255);
 	uint8_t b = Clamp8(static_cast<uint8_t>(Lerpf(c1.GetBlue(), c2.GetBlue(), t)), 0, 255);
@@ -100,3 +101,78 @@ Color Color::Lerp(const Color& c1, const Color& c2, float t, ease::EasingFunc fu
 
 	return Color(r, g, b, a);
 }
+
+Color Color::Lerp(const Color& c1, const Color& c2, float t, ease::EasingFunc func)
+{
+	return Lerp(c1, c2, func(t));
+}
+
+Color Color::Lerp(const Color& c1, const Color& c2, float t, ease::EasingType easing)
+{
+	return Lerp(c1, c2, ease::Evaluate(easing, t));
+}
+
+void Color::ConvertPixels(const uint8_t* source, size_t numPixels, const SourcePixelLayout& layout, Color* destination)
+{
+	//The vector path writes mColor and mR..mA as one 64-bit value per pixel
+	static_assert(std::is_trivially_copyable<Color>::value && sizeof(Color) == 8, "Color layout changed");
+	static_assert(offsetof(Color, mColor) == 0 && offsetof(Color, mR) == 4 && offsetof(Color, mA) == 7, "Color layout changed");
+
+	//Only 8888 screen formats can be built with shifts, anything else goes through SDL
+	const bool shiftable = mFormat && mFormat->BytesPerPixel == 4 && mFormat->Rloss == 0 && mFormat->Gloss == 0 && mFormat->Bloss == 0 && mFormat->Aloss == 0;
+
+	size_t i = 0;
+
+	if(shiftable)
+	{
+#ifdef COLOR_USE_SSE2
+		const __m128i byteMask = _mm_set1_epi32(0xFF);
+		const __m128i opaque = _mm_set1_epi32(0xFF);
+		const __m128i srcR = _mm_cvtsi32_si128(layout.rShift);
+		const __m128i srcG = _mm_cvtsi32_si128(layout.gShift);
+		const __m128i srcB = _mm_cvtsi32_si128(layout.bShift);
+		const __m128i srcA = _mm_cvtsi32_si128(layout.aShift);
+		const __m128i dstR = _mm_cvtsi32_si128(mFormat->Rshift);
+		const __m128i dstG = _mm_cvtsi32_si128(mFormat->Gshift);
+		const __m128i dstB = _mm_cvtsi32_si128(mFormat->Bshift);
+		const __m128i dstA = _mm_cvtsi32_si128(mFormat->Ashift);
+
+		for(; i + 4 <= numPixels; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+
+			__m128i r = _mm_and_si128(_mm_srl_epi32(pixels, srcR), byteMask);
+			__m128i g = _mm_and_si128(_mm_srl_epi32(pixels, srcG), byteMask);
+			__m128i b = _mm_and_si128(_mm_srl_epi32(pixels, srcB), byteMask);
+			__m128i a = layout.hasAlpha ? _mm_and_si128(_mm_srl_epi32(pixels, srcA), byteMask) : opaque;
+
+			__m128i screenPixels = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(r, dstR), _mm_sll_epi32(g, dstG)), _mm_or_si128(_mm_sll_epi32(b, dstB), _mm_sll_epi32(a, dstA)));
+			__m128i channels = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24)));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_unpacklo_epi32(screenPixels, channels));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 2), _mm_unpackhi_epi32(screenPixels, channels));
+		}
+#endif
+	}
+
+	for(; i < numPixels; ++i)
+	{
+		uint32_t pixel;
+		memcpy(&pixel, source + i * 4, sizeof(pixel));
+
+		Color& c = destination[i];
+		c.mR = static_cast<uint8_t>(pixel >> layout.rShift);
+		c.mG = static_cast<uint8_t>(pixel >> layout.gShift);
+		c.mB = static_cast<uint8_t>(pixel >> layout.bShift);
+		c.mA = layout.hasAlpha ? static_cast<uint8_t>(pixel >> layout.aShift) : 255;
+
+		if(shiftable)
+		{
+			c.mColor = (uint32_t(c.mR) << mFormat->Rshift) | (uint32_t(c.mG) << mFormat->Gshift) | (uint32_t(c.mB) << mFormat->Bshift) | (uint32_t(c.mA) << mFormat->Ashift);
+		}
+		else
+		{
+			c.Generate32BitColor();
+		}
+	}
+}
@@ -9,10 +9,21 @@
 #define GRAPHICS_COLOR_H_
 
 #include <stdint.h>
+#include <stddef.h>
 #include "Easings.h"
 
 struct SDL_PixelFormat;
 
+//Where each 8-bit channel sits in a 32-bit source pixel, ie. {16, 8, 0, 24} for a BMP's BGRA bytes
+struct SourcePixelLayout
+{
+	uint8_t rShift = 16;
+	uint8_t gShift = 8;
+	uint8_t bShift = 0;
+	uint8_t aShift = 24;
+	bool hasAlpha = true; //false - alpha is 255
+};
+
 class Color
 {
 	uint32_t mColor;
@@ -64,6 +75,11 @@ public:
 	static Color Lerp(const Color& c1, const Color& c2, float t);
 
 	static Color Lerp(const Color& c1, const Color& c2, float t, ease::EasingFunc func);
+	static Color Lerp(const Color& c1, const Color& c2, float t, ease::EasingType easing);
+
+	//Converts numPixels little endian 32-bit pixels to the screen's format, 4 at a time with SSE2.
+	//source doesn't need to be aligned.
+	static void ConvertPixels(const uint8_t* source, size_t numPixels, const SourcePixelLayout& layout, Color* destination);
 };
 
 
@@ -20,7 +20,9 @@
 #include <cassert>
 #include <cmath>
 #include <algorithm>
+#include <cstring>
 #include "App.h"
+#include "Profiler.h"
 
 namespace
 {
@@ -42,6 +44,7 @@ Screen::Screen()
 	, mTexture(nullptr)
 	, mBackgroundTexture(nullptr)
 	, mFast(true)
+	, mnoptrRenderTarget(nullptr)
 	, mScreenShakeTimer(0)
 	, mScreenShakePower(0)
 	, mScreenShakeOffset(Vec2D::Zero)
@@ -162,6 +165,8 @@ SDL_Window* Screen::Init(uint32_t w, uint32_t h, uint32_t mag, bool fast)
 
 		mBackBuffer.Clear();
 
+		mnoptrRenderTarget = &mBackBuffer;
+
 		mBackgroundBuffer.Init(mPixelFormat->format, mWidth, mHeight);
 		mBackgroundBuffer.Clear();
 	}
@@ -250,7 +255,8 @@ void Screen::Draw(int x, int y, const Color& color)
 	assert(moptrWindow);
 	if(moptrWindow)
 	{
-		SetPixel(mBackBuffer, color, x, y);
+		PROFILE_COUNTER_ADD("Draws", 1);
+		SetPixel(*mnoptrRenderTarget, color, x, y);
 	}
 }
 
@@ -259,7 +265,8 @@ void Screen::Draw(const Vec2D& point, const Color& color)
 	assert(moptrWindow);
 	if(moptrWindow)
 	{
-		SetPixel(mBackBuffer, color, static_cast<int>(point.GetX()), static_cast<int>(point.GetY()));
+		PROFILE_COUNTER_ADD("Draws", 1);
+		SetPixel(*mnoptrRenderTarget, color, static_cast<int>(point.GetX()), static_cast<int>(point.GetY()));
 	}
 }
 
@@ -268,6 +275,8 @@ void Screen::Draw(const Line2D& line, const Color& color)
 	assert(moptrWindow);
 	if(moptrWindow)
 	{
+		PROFILE_COUNTER_ADD("Draws", 1);
+
 		int dx, dy;
 
 		int x0 = static_cast<int>(roundf(line.GetP0().GetX()));
@@ -399,32 +408,25 @@ void Screen::Draw(const Circle& circle, const Color& color, bool fill, const Col
 	}
 }
 
+void Screen::Draw(const SpriteSheet& ss, SpriteId spriteId, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams)
+{
+	Draw(ss.GetBMPImage(), ss.GetSprite(spriteId), transform, colorParams, uvParams);
+}
+
 void Screen::Draw(const SpriteSheet& ss, const std::string& spriteName, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams)
 {
-	Draw(ss.GetBMPImage(), ss.GetSprite(spriteName), transform, colorParams, uvParams);
+	Draw(ss, ss.GetSpriteId(spriteName), transform, colorParams, uvParams);
 }
 
 void Screen::Draw(const BMPImage& image, const Sprite& sprite, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams, DrawSurface drawSurface)
 {
-	float normalizedOverlayColor[4];
-	normalizedOverlayColor[0] = static_cast<float>(colorParams.overlay.GetRed()) / 255.0f;
-	normalizedOverlayColor[1] = static_cast<float>(colorParams.overlay.GetGreen()) / 255.0f;
-	normalizedOverlayColor[2] = static_cast<float>(colorParams.overlay.GetBlue()) / 255.0f;
-	normalizedOverlayColor[3] = static_cast<float>(colorParams.overlay.GetAlpha()) / 255.0f;
-
-	const std::vector<Color>& pixels = image.GetPixels();
-
-	std::vector<Vec2D> points;
-
-	Vec2D xAxis;
-	Vec2D yAxis;
-
-	float invXAxisLengthSq;
-	float invYAxisLengthSq;
+	SpriteDrawSetup setup;
+	SetupSpriteDraw(image, sprite, colorParams, setup);
 
-	GetObjectAxis(transform.pos, sprite.width, sprite.height, transform.rotationAngle, transform.scale, xAxis, yAxis, invXAxisLengthSq, invYAxisLengthSq, points);
+	SpriteQuad quad;
+	GetSpriteQuad(sprite, transform, quad);
 
-	ScreenBuffer* screenBufferPtr = &mBackBuffer;
+	ScreenBuffer* screenBufferPtr = mnoptrRenderTarget;
 	if (drawSurface == BACKGROUND)
 	{
 		screenBufferPtr = &mBackgroundBuffer;
@@ -432,43 +434,224 @@ void Screen::Draw(const BMPImage& image, const Sprite& sprite, const DrawTransfo
 
 	FillPolySprite(
 		*screenBufferPtr,
-		points,
-		pixels,
+		quad.points,
+		image,
+		setup.palette,
 		image.GetWidth(),
-		normalizedOverlayColor,
-		Vec2D(static_cast<float>(sprite.xPos), static_cast<float>(sprite.yPos)),
-		Vec2D(static_cast<float>(sprite.width), static_cast<float>(sprite.height)),
-		xAxis, yAxis,
-		invXAxisLengthSq, invYAxisLengthSq,
+		setup.normalizedOverlayColor,
+		setup.spritePos,
+		setup.spriteSize,
+		quad.xAxis, quad.yAxis,
+		quad.invXAxisLengthSq, quad.invYAxisLengthSq,
 		colorParams.alpha,
 		colorParams.bilinearFiltering, colorParams.gradient, uvParams);
 }
 
+void Screen::DrawInstances(const BMPImage& image, const Sprite& sprite, const DrawTransform* transforms, size_t numInstances, const ColorParams& colorParams, const UVParams& uvParams)
+{
+	if (numInstances == 0)
+	{
+		return;
+	}
+
+	//Everything that doesn't depend on the transform is done once for all instances
+	SpriteDrawSetup setup;
+	SetupSpriteDraw(image, sprite, colorParams, setup);
+
+	std::vector<SpriteQuad> visibleQuads;
+	visibleQuads.reserve(numInstances);
+
+	const float targetWidth = static_cast<float>(mnoptrRenderTarget->Width());
+	const float targetHeight = static_cast<float>(mnoptrRenderTarget->Height());
+
+	for (size_t i = 0; i < numInstances; ++i)
+	{
+		SpriteQuad quad;
+		GetSpriteQuad(sprite, transforms[i], quad);
+
+		if (quad.right < 0.0f || quad.bottom < 0.0f || quad.left >= targetWidth || quad.top >= targetHeight)
+		{
+			continue;
+		}
+
+		visibleQuads.push_back(quad);
+	}
+
+	//Same texels for every instance - walking the instances top to bottom keeps the destination rows in cache as well
+	std::vector<SpriteQuad> sortedQuads = visibleQuads;
+	std::stable_sort(sortedQuads.begin(), sortedQuads.end(), [](const SpriteQuad& a, const SpriteQuad& b) {
+		return a.top < b.top || (a.top == b.top && a.left < b.left);
+	});
+
+	//The order only doesn't show if no two instances touch the same pixels - any overlap and they're drawn
+	//in submission order, the later one on top
+	bool overlapping = false;
+
+	for (size_t i = 0; i < sortedQuads.size() && !overlapping; ++i)
+	{
+		for (size_t j = i + 1; j < sortedQuads.size() && sortedQuads[j].top <= sortedQuads[i].bottom; ++j)
+		{
+			if (sortedQuads[j].left <= sortedQuads[i].right && sortedQuads[i].left <= sortedQuads[j].right)
+			{
+				overlapping = true;
+				break;
+			}
+		}
+	}
+
+	for (const SpriteQuad& quad : overlapping ? visibleQuads : sortedQuads)
+	{
+		FillPolySprite(
+			*mnoptrRenderTarget,
+			quad.points,
+			image,
+			setup.palette,
+			image.GetWidth(),
+			setup.normalizedOverlayColor,
+			setup.spritePos,
+			setup.spriteSize,
+			quad.xAxis, quad.yAxis,
+			quad.invXAxisLengthSq, quad.invYAxisLengthSq,
+			colorParams.alpha,
+			colorParams.bilinearFiltering, colorParams.gradient, uvParams);
+	}
+}
+
+void Screen::DrawInstances(const BMPImage& image, const Sprite& sprite, const std::vector<DrawTransform>& transforms, const ColorParams& colorParams, const UVParams& uvParams)
+{
+	DrawInstances(image, sprite, transforms.data(), transforms.size(), colorParams, uvParams);
+}
+
+void Screen::DrawInstances(const SpriteSheet& ss, SpriteId spriteId, const std::vector<DrawTransform>& transforms, const ColorParams& colorParams, const UVParams& uvParams)
+{
+	DrawInstances(ss.GetBMPImage(), ss.GetSprite(spriteId), transforms.data(), transforms.size(), colorParams, uvParams);
+}
+
+void Screen::DrawInstances(const SpriteSheet& ss, const std::string& spriteName, const std::vector<DrawTransform>& transforms, const ColorParams& colorParams, const UVParams& uvParams)
+{
+	DrawInstances(ss, ss.GetSpriteId(spriteName), transforms, colorParams, uvParams);
+}
+
 void Screen::Draw(const BitmapFont& font, const std::string& textLine, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams)
 {
 	uint32_t xPos = static_cast<uint32_t>(transform.pos.GetX());
 
-	const SpriteSheet& ss = font.GetSpriteSheet();
+	const BMPImage& image = font.GetSpriteSheet().GetBMPImage();
 
 	for (char c : textLine)
 	{
-		if (c == ' ')
+		const BitmapFontGlyph& glyph = font.GetGlyph(c);
+
+		if (glyph.sprite.width > 0)
 		{
-			xPos += font.GetFontSpacingBetweenWords();
-			continue;
+			DrawTransform newTransform = transform;
+			newTransform.pos = Vec2D(static_cast<float>(xPos), transform.pos.GetY());
+
+			Draw(image, glyph.sprite, newTransform, colorParams, uvParams);
 		}
 
-		Sprite sprite = ss.GetSprite(std::string("") + c);
+		xPos += glyph.advance;
+	}
+}
 
-		DrawTransform newTransform = transform;
-		newTransform.pos = Vec2D(static_cast<float>(xPos), transform.pos.GetY());
+void Screen::SetRenderTarget(ScreenBuffer* renderTarget)
+{
+	mnoptrRenderTarget = renderTarget ? renderTarget : &mBackBuffer;
+}
 
-		Draw(ss.GetBMPImage(), sprite, newTransform, colorParams, uvParams);
+void Screen::InitRenderTarget(ScreenBuffer& renderTarget, uint32_t width, uint32_t height) const
+{
+	assert(mPixelFormat);
+	renderTarget.Init(mPixelFormat->format, width, height);
+}
 
-		xPos += sprite.width;
+void Screen::Draw(const ScreenBuffer& source, const DrawTransform& transform, const ColorParams& colorParams)
+{
+	const SDL_Surface* sourceSurface = source.GetSurface();
+	assert(sourceSurface);
 
-		xPos += font.GetFontSpacingBetweenLetters();
+	if (!sourceSurface || mnoptrRenderTarget == &source)
+	{
+		return;
 	}
+
+	const int sourceWidth = sourceSurface->w;
+	const int sourceHeight = sourceSurface->h;
+
+	const bool untransformed = IsEqual(transform.scale, 1.0f) && IsEqual(transform.rotationAngle, 0.0f);
+	const bool unmodulated = colorParams.overlay == Color::White() && colorParams.alpha >= 1.0f;
+
+	if (untransformed && unmodulated)
+	{
+		PROFILE_COUNTER_ADD("Draws", 1);
+
+		//Straight copy - just walk the part of the source that lands on the target
+		const int x0 = static_cast<int>(roundf(transform.pos.GetX()));
+		const int y0 = static_cast<int>(roundf(transform.pos.GetY()));
+
+		const int startX = std::max(0, -x0);
+		const int startY = std::max(0, -y0);
+		const int endX = std::min(sourceWidth, static_cast<int>(mnoptrRenderTarget->Width()) - x0);
+		const int endY = std::min(sourceHeight, static_cast<int>(mnoptrRenderTarget->Height()) - y0);
+
+		const uint32_t* sourcePixels = static_cast<const uint32_t*>(sourceSurface->pixels);
+
+		for (int r = startY; r < endY; ++r)
+		{
+			for (int c = startX; c < endX; ++c)
+			{
+				uint32_t pixel = sourcePixels[GetIndex(sourceWidth, r, c)];
+
+				if ((pixel & mPixelFormat->Amask) == 0)
+				{
+					continue;
+				}
+
+				SetPixel(*mnoptrRenderTarget, Color(pixel), x0 + c, y0 + r);
+			}
+		}
+
+		return;
+	}
+
+	Vec2D xAxis;
+	Vec2D yAxis;
+	float invXAxisLengthSq;
+	float invYAxisLengthSq;
+	std::array<Vec2D, 4> points;
+
+	GetObjectAxis(transform.pos, sourceWidth, sourceHeight, transform.rotationAngle, transform.scale, xAxis, yAxis, invXAxisLengthSq, invYAxisLengthSq, points);
+
+	const Vec2D topLeft = points[0];
+	const Color overlay = colorParams.overlay;
+	const float alpha = colorParams.alpha;
+
+	FillPoly(std::vector<Vec2D>(points.begin(), points.end()), [&](uint32_t x, uint32_t y) {
+		Vec2D p = { static_cast<float>(static_cast<int>(x)), static_cast<float>(static_cast<int>(y)) };
+		Vec2D uv = ConvertWorldSpaceToUVSpace(p, topLeft, xAxis, yAxis, invXAxisLengthSq, invYAxisLengthSq);
+
+		int c = std::min(std::max(static_cast<int>(uv.GetX() * sourceWidth), 0), sourceWidth - 1);
+		int r = std::min(std::max(static_cast<int>(uv.GetY() * sourceHeight), 0), sourceHeight - 1);
+
+		Color color = source.GetPixel(c, r);
+
+		return Color(
+			static_cast<uint8_t>((color.GetRed() * overlay.GetRed()) / 255),
+			static_cast<uint8_t>((color.GetGreen() * overlay.GetGreen()) / 255),
+			static_cast<uint8_t>((color.GetBlue() * overlay.GetBlue()) / 255),
+			static_cast<uint8_t>(((color.GetAlpha() * overlay.GetAlpha()) / 255) * alpha));
+	});
+}
+
+void Screen::DrawCachedText(const BitmapFont& font, const std::string& textLine, const Vec2D& pos, const ColorParams& colorParams)
+{
+	const ScreenBuffer& run = mTextRunCache.GetRun(*this, font, textLine, colorParams);
+
+	//The font path truncates x and the blit would round it - truncate here so cached and uncached text line up
+	DrawTransform transform;
+	transform.pos = Vec2D(static_cast<float>(static_cast<int>(pos.GetX())), pos.GetY());
+
+	Draw(run, transform);
 }
 
 void Screen::Draw(const BMPImage& image, const Sprite& sprite, const Vec2D& pos, float angle, float scale, const Color& overlayColor, float alpha, bool bilinearFilter)
@@ -559,6 +742,57 @@ void Screen::ClearBackground()
 }
 
 
+uint32_t Screen::RegisterHUDElement(const AARectangle& bounds, HUDDrawFunc drawFunc)
+{
+	std::unique_ptr<HUDElement> element = std::make_unique<HUDElement>();
+
+	element->origin = bounds.GetTopLeftPoint();
+	element->drawFunc = drawFunc;
+
+	InitRenderTarget(element->layer, static_cast<uint32_t>(bounds.GetWidth()), static_cast<uint32_t>(bounds.GetHeight()));
+
+	mHUDElements.push_back(std::move(element));
+
+	return static_cast<uint32_t>(mHUDElements.size() - 1);
+}
+
+void Screen::DrawHUDElement(uint32_t elementId, uint64_t key)
+{
+	assert(elementId < mHUDElements.size());
+
+	if (elementId >= mHUDElements.size())
+	{
+		return;
+	}
+
+	HUDElement& element = *mHUDElements[elementId];
+
+	if (!element.rendered || element.key != key)
+	{
+		ScreenBuffer* previousTarget = mnoptrRenderTarget;
+
+		element.layer.Clear();
+		SetRenderTarget(&element.layer);
+
+		element.drawFunc(*this, element.origin);
+
+		SetRenderTarget(previousTarget);
+
+		element.key = key;
+		element.rendered = true;
+	}
+
+	DrawTransform transform;
+	transform.pos = element.origin;
+
+	Draw(element.layer, transform);
+}
+
+void Screen::ClearHUDElements()
+{
+	mHUDElements.clear();
+}
+
 void Screen::Shake(float power, float durationInSeconds)
 {
 	mScreenShakeTimer = SecondsToMilliseconds(durationInSeconds);
@@ -567,6 +801,8 @@ void Screen::Shake(float power, float durationInSeconds)
 
 void Screen::FillPoly(const std::vector<Vec2D>& points, FillPolyFunc func)
 {
+	PROFILE_COUNTER_ADD("Draws", 1);
+
 	if(points.size() > 0)
 	{
 		float top = points[0].GetY();
@@ -655,17 +891,108 @@ void Screen::FillPoly(const std::vector<Vec2D>& points, FillPolyFunc func)
 	}
 }
 
+void Screen::SetupSpriteDraw(const BMPImage& image, const Sprite& sprite, const ColorParams& colorParams, SpriteDrawSetup& setup)
+{
+	setup.normalizedOverlayColor[0] = static_cast<float>(colorParams.overlay.GetRed()) / 255.0f;
+	setup.normalizedOverlayColor[1] = static_cast<float>(colorParams.overlay.GetGreen()) / 255.0f;
+	setup.normalizedOverlayColor[2] = static_cast<float>(colorParams.overlay.GetBlue()) / 255.0f;
+	setup.normalizedOverlayColor[3] = static_cast<float>(colorParams.overlay.GetAlpha()) / 255.0f;
+
+	setup.spritePos = Vec2D(static_cast<float>(sprite.xPos), static_cast<float>(sprite.yPos));
+	setup.spriteSize = Vec2D(static_cast<float>(sprite.StoredWidth()), static_cast<float>(sprite.StoredHeight()));
+
+	//For indexed images resolve the overlay and alpha once per palette entry instead of once per pixel.
+	//Gradients vary per pixel so they still go through the per-pixel multiply.
+	setup.palette = nullptr;
+
+	const bool hasGradient = colorParams.gradient.xParam != NO_X_GRADIENT || colorParams.gradient.yParam != NO_Y_GRADIENT;
+
+	if (image.IsIndexed() && !hasGradient)
+	{
+		const std::vector<Color>& sourcePalette = colorParams.palette ? *colorParams.palette : image.GetPalette();
+
+		assert(sourcePalette.size() == image.GetPalette().size() && "Palette swap doesn't match the image's palette size");
+
+		if (colorParams.overlay == Color::White() && colorParams.alpha >= 1.0f)
+		{
+			setup.palette = sourcePalette.data();
+		}
+		else
+		{
+			for (size_t i = 0; i < sourcePalette.size(); ++i)
+			{
+				const Color& c = sourcePalette[i];
+
+				setup.modulatedPalette[i] = Color(
+					static_cast<uint8_t>(c.GetRed() * setup.normalizedOverlayColor[0]),
+					static_cast<uint8_t>(c.GetGreen() * setup.normalizedOverlayColor[1]),
+					static_cast<uint8_t>(c.GetBlue() * setup.normalizedOverlayColor[2]),
+					static_cast<uint8_t>(c.GetAlpha() * setup.normalizedOverlayColor[3] * colorParams.alpha));
+			}
+
+			setup.palette = setup.modulatedPalette.data();
+		}
+	}
+}
+
+void Screen::GetSpriteQuad(const Sprite& sprite, const DrawTransform& transform, SpriteQuad& quad)
+{
+	GetObjectAxis(transform.pos, sprite.width, sprite.height, transform.rotationAngle, transform.scale, quad.xAxis, quad.yAxis, quad.invXAxisLengthSq, quad.invYAxisLengthSq, quad.points);
+
+	if (sprite.IsTrimmed())
+	{
+		//The axes above are for the untrimmed rect so rotation and scale happen around the same center -
+		//shrink the quad to the stored pixels so we don't walk the transparent border
+		Vec2D xStep = quad.xAxis / static_cast<float>(sprite.width);
+		Vec2D yStep = quad.yAxis / static_cast<float>(sprite.height);
+
+		Vec2D topLeft = quad.points[0] + xStep * static_cast<float>(sprite.trimX) + yStep * static_cast<float>(sprite.trimY);
+
+		quad.xAxis = xStep * static_cast<float>(sprite.trimWidth);
+		quad.yAxis = yStep * static_cast<float>(sprite.trimHeight);
+
+		quad.invXAxisLengthSq = 1.0f / quad.xAxis.Mag2();
+		quad.invYAxisLengthSq = 1.0f / quad.yAxis.Mag2();
+
+		quad.points = { topLeft, topLeft + quad.yAxis, topLeft + quad.xAxis + quad.yAxis, topLeft + quad.xAxis };
+	}
+
+	quad.left = quad.right = quad.points[0].GetX();
+	quad.top = quad.bottom = quad.points[0].GetY();
+
+	for (const Vec2D& point : quad.points)
+	{
+		quad.left = std::min(quad.left, point.GetX());
+		quad.right = std::max(quad.right, point.GetX());
+		quad.top = std::min(quad.top, point.GetY());
+		quad.bottom = std::max(quad.bottom, point.GetY());
+	}
+}
+
 void Screen::SetPixel(ScreenBuffer& screenBuffer, const Color& color, int x, int y)
 {
+	SDL_Surface* backgroundSurface = mBackgroundBuffer.GetSurface();
+	SDL_Surface* backBufferSurface = mBackBuffer.GetSurface();
+
+	if (screenBuffer.GetSurface() != backBufferSurface && screenBuffer.GetSurface() != backgroundSurface)
+	{
+		//Offscreen render target - there's nothing underneath it yet, keep its alpha for when it gets composited
+		//It clips for itself, so these are counted even if they miss
+		PROFILE_COUNTER_ADD("Pixels", 1);
+		PROFILE_COUNTER_ADD("Blended", color.GetAlpha() < 255 ? 1 : 0);
+		screenBuffer.BlendPixel(color, x, y);
+		return;
+	}
+
 	if (!(y >= 0 && y < static_cast<int>(mHeight) && x >= 0 && x < static_cast<int>(mWidth)))
 	{
 		return;
 	}
 
-	Color surfaceColor;
+	PROFILE_COUNTER_ADD("Pixels", 1);
+	PROFILE_COUNTER_ADD("Blended", color.GetAlpha() < 255 ? 1 : 0);
 
-	SDL_Surface* backgroundSurface = mBackgroundBuffer.GetSurface();
-	SDL_Surface* backBufferSurface = mBackBuffer.GetSurface();
+	Color surfaceColor;
 
 	if (screenBuffer.GetSurface() == backBufferSurface)
 	{
@@ -704,7 +1031,8 @@ void Screen::SetPixel(ScreenBuffer& screenBuffer, const Color& color, int x, int
 
 void Screen::DrawBilinearFilteredPixel(
 	ScreenBuffer& screenBuffer,
-	const std::vector<Color>& imagePixels,
+	const BMPImage& image,
+	const Color* palette,
 	int pixelX,
 	int pixelY,
 	const Vec2D& uv,
@@ -716,8 +1044,10 @@ void Screen::DrawBilinearFilteredPixel(
 	const GradientParams& gradient, 
 	const UVParams& uvParams)
 {
-	float tx = 1.0f + uv.GetX() * static_cast<float>(spriteSize.GetX() - 3.0f);
-	float ty = 1.0f + uv.GetY() * static_cast<float>(spriteSize.GetY() - 3.0f);
+	//Stay a texel in from the edges so the 2x2 footprint never leaves the sprite - except for sprites
+	//too small to have an inside, like the 1x1 a packed sheet keeps for a fully transparent one
+	float tx = spriteSize.GetX() >= 3.0f ? 1.0f + uv.GetX() * (spriteSize.GetX() - 3.0f) : 0.0f;
+	float ty = spriteSize.GetY() >= 3.0f ? 1.0f + uv.GetY() * (spriteSize.GetY() - 3.0f) : 0.0f;
 
 	uint32_t txInt = (uint32_t)tx;
 	uint32_t tyInt = (uint32_t)ty;
@@ -734,15 +1064,27 @@ void Screen::DrawBilinearFilteredPixel(
 	auto pixelIndex3 = GetIndex(imageWidth, row + 1, col);
 	auto pixelIndex4 = GetIndex(imageWidth, row + 1, col + 1);
 
-	if (pixelIndex < imagePixels.size() &&
-		pixelIndex2 < imagePixels.size() &&
-		pixelIndex3 < imagePixels.size() &&
-		pixelIndex4 < imagePixels.size())
+	if (pixelIndex4 < image.NumPixels())
 	{
-		Color imageColor = imagePixels[pixelIndex];
-		Color imageColor2 = imagePixels[pixelIndex2];
-		Color imageColor3 = imagePixels[pixelIndex3];
-		Color imageColor4 = imagePixels[pixelIndex4];
+		if (palette)
+		{
+			//Palette was already multiplied by the overlay and alpha - just filter the resolved entries
+			const uint8_t* indices = image.GetIndices();
+
+			Color result = Color::Lerp(
+				Color::Lerp(palette[indices[pixelIndex]], palette[indices[pixelIndex2]], fx),
+				Color::Lerp(palette[indices[pixelIndex3]], palette[indices[pixelIndex4]], fx), fy);
+
+			ClipUV(uv, uvParams, result);
+
+			SetPixel(screenBuffer, result, pixelX, pixelY);
+			return;
+		}
+
+		Color imageColor = image.GetPixel(pixelIndex);
+		Color imageColor2 = image.GetPixel(pixelIndex2);
+		Color imageColor3 = image.GetPixel(pixelIndex3);
+		Color imageColor4 = image.GetPixel(pixelIndex4);
 
 		Color result = Color::Lerp(Color::Lerp(imageColor, imageColor2, fx), Color::Lerp(imageColor3, imageColor4, fx), fy);
 
@@ -764,7 +1106,8 @@ void Screen::DrawBilinearFilteredPixel(
 
 void Screen::DrawUnfilteredPixel(
 	ScreenBuffer& screenBuffer,
-	const std::vector<Color>& imagePixels,
+	const BMPImage& image,
+	const Color* palette,
 	int pixelX,
 	int pixelY,
 	const Vec2D& uv,
@@ -784,13 +1127,23 @@ void Screen::DrawUnfilteredPixel(
 
 	auto pixelIndex = GetIndex(imageWidth, row, col);
 
-	if (pixelIndex < imagePixels.size())
+	if (pixelIndex < image.NumPixels())
 	{
+		if (palette)
+		{
+			Color paletteColor = palette[image.GetIndices()[pixelIndex]];
+
+			ClipUV(uv, uvParams, paletteColor);
+
+			SetPixel(screenBuffer, paletteColor, pixelX, pixelY);
+			return;
+		}
+
 		float newOverlayColor[4] = { overlayColor[0], overlayColor[1], overlayColor[2], overlayColor[3] };
 
 		Gradient(gradient, uv.GetX(), uv.GetY(), newOverlayColor);
 
-		Color imageColor = imagePixels[pixelIndex];
+		Color imageColor = image.GetPixel(pixelIndex);
 
 		ClipUV(uv, uvParams, imageColor);
 
@@ -838,8 +1191,9 @@ void Screen::ClipUV(const Vec2D& uv, const UVParams& uvParams, Color& imageColor
 
 void Screen::FillPolySprite(
 	ScreenBuffer& screenBuffer,
-	const std::vector<Vec2D>& points,
-	const std::vector<Color>& imagePixels,
+	const std::array<Vec2D, 4>& points,
+	const BMPImage& image,
+	const Color* palette,
 	uint32_t imageWidth,
 	const float overlayColor[4],
 	const Vec2D& spritePos,
@@ -853,6 +1207,8 @@ void Screen::FillPolySprite(
 	const GradientParams& gradient,
 	const UVParams& uvParams) 
 {
+	PROFILE_COUNTER_ADD("Draws", 1);
+
 	if (points.size() > 0)
 	{
 		float top = points[0].GetY();
@@ -886,7 +1242,9 @@ void Screen::FillPolySprite(
 
 		for (int pixelY = (int)roundf(top); pixelY < (int)roundf(bottom); ++pixelY)
 		{
-			std::vector<float> nodeXVec;
+			//A quad crosses a scanline at most 4 times
+			float nodeX[4];
+			size_t numNodes = 0;
 
 			size_t j = points.size() - 1;
 
@@ -905,38 +1263,38 @@ void Screen::FillPolySprite(
 					}
 
 					float x = points[i].GetX() + (pixelY - pointiY) / (denom) * (points[j].GetX() - points[i].GetX());
-					nodeXVec.push_back(x);
+					nodeX[numNodes++] = x;
 				}
 
 				j = i;
 			}
 
-			std::sort(nodeXVec.begin(), nodeXVec.end(), std::less<>());
+			std::sort(nodeX, nodeX + numNodes);
 
-			for (size_t k = 0; k < nodeXVec.size(); k += 2)
+			for (size_t k = 0; k < numNodes; k += 2)
 			{
-				if (nodeXVec[k] > right)
+				if (nodeX[k] > right)
 				{
 					break;
 				}
 
-				if (k + 1 >= nodeXVec.size())
+				if (k + 1 >= numNodes)
 				{
 					break;
 				}
 
-				if (nodeXVec[k + 1] > left)
+				if (nodeX[k + 1] > left)
 				{
-					if (nodeXVec[k] < left)
+					if (nodeX[k] < left)
 					{
-						nodeXVec[k] = left;
+						nodeX[k] = left;
 					}
-					if (nodeXVec[k + 1] > right)
+					if (nodeX[k + 1] > right)
 					{
-						nodeXVec[k + 1] = right;
+						nodeX[k + 1] = right;
 					}
 
-					for (int pixelX = (int)roundf(nodeXVec[k]); pixelX < (int)roundf(nodeXVec[k + 1]); ++pixelX)
+					for (int pixelX = (int)roundf(nodeX[k]); pixelX < (int)roundf(nodeX[k + 1]); ++pixelX)
 					{
 						Vec2D p = { static_cast<float>(pixelX), static_cast<float>(pixelY) };
 
@@ -946,7 +1304,8 @@ void Screen::FillPolySprite(
 						{
 							DrawUnfilteredPixel(
 								screenBuffer,
-								imagePixels,
+								image,
+								palette,
 								pixelX,
 								pixelY,
 								uv,
@@ -962,7 +1321,8 @@ void Screen::FillPolySprite(
 						{
 							DrawBilinearFilteredPixel(
 								screenBuffer,
-								imagePixels,
+								image,
+								palette,
 								pixelX,
 								pixelY,
 								uv,
@@ -11,8 +11,12 @@
 #include <stdint.h>
 #include "ScreenBuffer.h"
 #include "Color.h"
+#include "TextRunCache.h"
+#include "SpriteSheet.h"
 #include <functional>
 #include <vector>
+#include <array>
+#include <memory>
 
 #include "Vec2D.h"
 
@@ -22,9 +26,6 @@ class AARectangle;
 class Circle;
 struct SDL_Window;
 struct SDL_Surface;
-class BMPImage;
-class SpriteSheet;
-struct Sprite;
 class BitmapFont;
 
 struct SDL_Renderer;
@@ -81,6 +82,8 @@ struct ColorParams
 	Color overlay = Color::White();
 	float alpha = 1.0f;
 	bool bilinearFiltering = false;
+	//Optional palette swap for indexed images - must have as many entries as the image's own palette
+	const std::vector<Color>* palette = nullptr;
 };
 
 enum DrawSurface
@@ -103,6 +106,12 @@ public:
 	inline uint32_t Width() const {return mWidth;}
 	inline uint32_t Height() const {return mHeight;}
 
+	//Render targets - every Draw goes into the current target (the back buffer unless set).
+	//Offscreen targets keep their alpha so they can be drawn back with Draw(ScreenBuffer...)
+	void SetRenderTarget(ScreenBuffer* renderTarget);
+	inline ScreenBuffer* GetRenderTarget() const {return mnoptrRenderTarget;}
+	void InitRenderTarget(ScreenBuffer& renderTarget, uint32_t width, uint32_t height) const;
+
 	//Draw Methods go here
 
 	void Draw(int x, int y, const Color& color);
@@ -115,8 +124,21 @@ public:
 
 	void Draw(const BMPImage& image, const Sprite& sprite, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams, DrawSurface drawSurface = FOREGROUND);
 
+	void Draw(const SpriteSheet& ss, SpriteId spriteId, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams);
 	void Draw(const SpriteSheet& ss, const std::string& spriteName, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams);
 	void Draw(const BitmapFont& font, const std::string& textLine, const DrawTransform& transform, const ColorParams& colorParams, const UVParams& uvParams);
+	void Draw(const ScreenBuffer& source, const DrawTransform& transform, const ColorParams& colorParams = ColorParams());
+
+	//Draws text through the text run cache - meant for strings that don't change often, no rotation or scaling
+	void DrawCachedText(const BitmapFont& font, const std::string& textLine, const Vec2D& pos, const ColorParams& colorParams = ColorParams());
+	inline TextRunCache& GetTextRunCache() {return mTextRunCache;}
+
+	//Draws the same sprite once per transform - the sprite setup is done once, off screen instances are culled up front.
+	//Instances that overlap are drawn in the order given, the rest in whatever order is fastest
+	void DrawInstances(const BMPImage& image, const Sprite& sprite, const DrawTransform* transforms, size_t numInstances, const ColorParams& colorParams, const UVParams& uvParams);
+	void DrawInstances(const BMPImage& image, const Sprite& sprite, const std::vector<DrawTransform>& transforms, const ColorParams& colorParams, const UVParams& uvParams);
+	void DrawInstances(const SpriteSheet& ss, SpriteId spriteId, const std::vector<DrawTransform>& transforms, const ColorParams& colorParams, const UVParams& uvParams);
+	void DrawInstances(const SpriteSheet& ss, const std::string& spriteName, const std::vector<DrawTransform>& transforms, const ColorParams& colorParams, const UVParams& uvParams);
 
 
 	//Deprecated for the other games
@@ -129,6 +151,16 @@ public:
 
 	void ClearBackground();
 
+	//Retained HUD - an element is rendered into its own layer and only re-rendered when the key passed
+	//to DrawHUDElement changes (score, lives...), otherwise its cached layer is just composited.
+	//The draw function gets the element's top left corner on the screen so it can draw relative to it.
+	using HUDDrawFunc = std::function<void (Screen& screen, const Vec2D& origin)>;
+	static const uint32_t INVALID_HUD_ELEMENT = UINT32_MAX;
+
+	uint32_t RegisterHUDElement(const AARectangle& bounds, HUDDrawFunc drawFunc);
+	void DrawHUDElement(uint32_t elementId, uint64_t key);
+	void ClearHUDElements();
+
 	//Screen shake
 	void Shake(float power, float durationInSeconds);
 
@@ -140,6 +172,42 @@ private:
 	void ClearScreen();
 
 	void SetPixel(ScreenBuffer& screenBuffer, const Color& color, int x, int y);
+
+	//Per sprite state that's the same for every transform it's drawn with
+	struct SpriteDrawSetup
+	{
+		float normalizedOverlayColor[4];
+		std::array<Color, 256> modulatedPalette; //BMPImage::MAX_PALETTE_SIZE
+		const Color* palette = nullptr;
+		Vec2D spritePos;
+		Vec2D spriteSize;
+	};
+
+	//Screen space quad of one sprite instance
+	struct SpriteQuad
+	{
+		std::array<Vec2D, 4> points;
+		Vec2D xAxis;
+		Vec2D yAxis;
+		float invXAxisLengthSq = 0.0f;
+		float invYAxisLengthSq = 0.0f;
+		float left = 0.0f;
+		float right = 0.0f;
+		float top = 0.0f;
+		float bottom = 0.0f;
+	};
+
+	struct HUDElement
+	{
+		Vec2D origin;
+		HUDDrawFunc drawFunc = nullptr;
+		ScreenBuffer layer;
+		uint64_t key = 0;
+		bool rendered = false;
+	};
+
+	void SetupSpriteDraw(const BMPImage& image, const Sprite& sprite, const ColorParams& colorParams, SpriteDrawSetup& setup);
+	void GetSpriteQuad(const Sprite& sprite, const DrawTransform& transform, SpriteQuad& quad);
 	
 
 	using FillPolyFunc = std::function<Color (uint32_t x, uint32_t y)>;
@@ -148,8 +216,9 @@ private:
 
 	void FillPolySprite(
 		ScreenBuffer& screenBuffer,
-		const std::vector<Vec2D>& points,
-		const std::vector<Color>& imagePixels,
+		const std::array<Vec2D, 4>& points,
+		const BMPImage& image,
+		const Color* palette,
 		uint32_t imageWidth,
 		const float overlayColor[4],
 		const Vec2D& spritePos,
@@ -165,7 +234,8 @@ private:
 
 	void DrawBilinearFilteredPixel(
 		ScreenBuffer& screenBuffer,
-		const std::vector<Color>& imagePixels,
+		const BMPImage& image,
+		const Color* palette,
 		int pixelX,
 		int pixelY,
 		const Vec2D& uv,
@@ -179,7 +249,8 @@ private:
 
 	void DrawUnfilteredPixel(
 		ScreenBuffer& screenBuffer,
-		const std::vector<Color>& imagePixels,
+		const BMPImage& image,
+		const Color* palette,
 		int pixelX,
 		int pixelY,
 		const Vec2D& uv,
@@ -212,6 +283,12 @@ private:
 	SDL_Texture* mBackgroundTexture;
 	bool mFast;
 
+	ScreenBuffer* mnoptrRenderTarget;
+
+	std::vector<std::unique_ptr<HUDElement>> mHUDElements;
+
+	TextRunCache mTextRunCache;
+
 	//Screen Shake
 	int mScreenShakeTimer; // in milliseconds
 	float mScreenShakePower;
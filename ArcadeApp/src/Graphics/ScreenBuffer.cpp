@@ -56,6 +56,11 @@ ScreenBuffer& ScreenBuffer::operator=(const ScreenBuffer& screenBuffer)
 
 void ScreenBuffer::Init(uint32_t format, uint32_t width, uint32_t height)
 {
+	if(mSurface)
+	{
+		SDL_FreeSurface(mSurface);
+	}
+
 	mSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 0, format);
 	Clear();
 }
@@ -87,7 +92,75 @@ void ScreenBuffer::SetPixel(const Color& color, const Color& surfaceColor, int x
 	}
 }
 
-uint32_t ScreenBuffer::GetIndex(int r, int c)
+uint32_t ScreenBuffer::Width() const
+{
+	return mSurface ? static_cast<uint32_t>(mSurface->w) : 0;
+}
+
+uint32_t ScreenBuffer::Height() const
+{
+	return mSurface ? static_cast<uint32_t>(mSurface->h) : 0;
+}
+
+void ScreenBuffer::BlendPixel(const Color& color, int x, int y)
+{
+	assert(mSurface);
+
+	if(mSurface && (y < mSurface->h && y >= 0 && x >= 0 && x < mSurface->w))
+	{
+		if(color.GetAlpha() == 0)
+		{
+			return;
+		}
+
+		SDL_LockSurface(mSurface);
+
+		uint32_t * pixels = (uint32_t*)mSurface->pixels;
+		size_t index = GetIndex(y, x);
+
+		if(color.GetAlpha() == 255)
+		{
+			pixels[index] = color.GetPixelColor();
+		}
+		else
+		{
+			Color destination = Color(pixels[index]);
+
+			float sourceAlpha = static_cast<float>(color.GetAlpha()) / 255.0f;
+			float destinationAlpha = static_cast<float>(destination.GetAlpha()) / 255.0f * (1.0f - sourceAlpha);
+			float outAlpha = sourceAlpha + destinationAlpha;
+
+			auto blend = [&](uint8_t source, uint8_t dest) {
+				return static_cast<uint8_t>((static_cast<float>(source) * sourceAlpha + static_cast<float>(dest) * destinationAlpha) / outAlpha);
+			};
+
+			Color result(
+				blend(color.GetRed(), destination.GetRed()),
+				blend(color.GetGreen(), destination.GetGreen()),
+				blend(color.GetBlue(), destination.GetBlue()),
+				static_cast<uint8_t>(outAlpha * 255.0f));
+
+			pixels[index] = result.GetPixelColor();
+		}
+
+		SDL_UnlockSurface(mSurface);
+	}
+}
+
+Color ScreenBuffer::GetPixel(int x, int y) const
+{
+	assert(mSurface);
+
+	if(mSurface && (y < mSurface->h && y >= 0 && x >= 0 && x < mSurface->w))
+	{
+		const uint32_t * pixels = (const uint32_t*)mSurface->pixels;
+		return Color(pixels[GetIndex(y, x)]);
+	}
+
+	return Color::ClearBlack();
+}
+
+uint32_t ScreenBuffer::GetIndex(int r, int c) const
 {
 	assert(mSurface);
 	if(mSurface)
@@ -26,15 +26,25 @@ public:
 	void Init(uint32_t format, uint32_t width, uint32_t h);
 
 	inline SDL_Surface * GetSurface() {return mSurface;}
+	inline const SDL_Surface * GetSurface() const {return mSurface;}
+
+	uint32_t Width() const;
+	uint32_t Height() const;
 
 	void Clear(const Color& c = Color::ClearBlack());
 
 	void SetPixel(const Color& color, const Color& surfaceColor, int x, int y);
 
+	//Source over blend that keeps the destination's alpha - used by offscreen render targets
+	//so what's drawn into them can be composited again later
+	void BlendPixel(const Color& color, int x, int y);
+
+	Color GetPixel(int x, int y) const;
+
 private:
 
 	SDL_Surface * mSurface;
-	uint32_t GetIndex(int r, int c);
+	uint32_t GetIndex(int r, int c) const;
 };
 
 
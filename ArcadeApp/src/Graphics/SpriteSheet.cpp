@@ -9,40 +9,111 @@
 #include "FileCommandLoader.h"
 #include "Utils.h"
 #include "App.h"
+#include "AssetTables.h"
+#include <cstring>
 
-
-SpriteSheet::SpriteSheet()
+SpriteSheet::SpriteSheet(): mnoptrPackedSections(nullptr), mNumPackedSections(0)
 {
 
 }
 
 bool SpriteSheet::Load(const std::string& name)
 {
+	mName = name;
+	mPaletteSwaps.clear();
+
 	bool loadedImage = mBMPImage.Load(App::Singleton().GetBasePath() + std::string("assets/") + name + ".bmp");
-	bool loadedSpriteSections = LoadSpriteSections(App::Singleton().GetBasePath() + std::string("assets/") + name + ".txt");
+	bool loadedSpriteSections = LoadPackedSpriteSections(name + ".txt") || LoadSpriteSections(App::Singleton().GetBasePath() + std::string("assets/") + name + ".txt");
+
+	BuildSpriteIds();
 
 	return loadedImage && loadedSpriteSections;
 }
 
-Sprite SpriteSheet::GetSprite(const std::string& spriteName) const
+bool SpriteSheet::Load(const std::string& name, const ImageTable& image, const SpriteSectionsTable& sections)
 {
-	size_t length = mSections.size();
+	mName = name;
+	mPaletteSwaps.clear();
+
+	bool loadedImage = mBMPImage.Load(image);
+	SetSpriteSections(sections);
+
+	BuildSpriteIds();
 
-	for(size_t i = 0; i < length; ++i)
+	return loadedImage;
+}
+
+const Palette* SpriteSheet::GetPaletteSwap(const Color& color) const
+{
+	if(color == Color::White() || !mBMPImage.IsIndexed())
 	{
-		if(StringCompare(mSections[i].key, spriteName))
+		return nullptr;
+	}
+
+	for(const PaletteSwap& swap : mPaletteSwaps)
+	{
+		if(swap.color == color)
 		{
-			return mSections[i].sprite;
+			return &swap.palette;
 		}
 	}
 
-	return Sprite();
+	//Only a handful of frame colors are used per sheet (ghost colors, vulnerable flashing) so a small list is enough
+	PaletteSwap swap;
+	swap.color = color;
+	swap.palette = BMPImage::ModulatePalette(mBMPImage.GetPalette(), color);
+	mPaletteSwaps.push_back(std::move(swap));
+
+	return &mPaletteSwaps.back().palette;
+}
+
+SpriteId SpriteSheet::GetSpriteId(const std::string& spriteName) const
+{
+	auto iter = mSpriteIds.find(spriteName);
+
+	if(iter == mSpriteIds.end())
+	{
+		return INVALID_SPRITE_ID;
+	}
+
+	return iter->second;
+}
+
+Sprite SpriteSheet::GetSprite(SpriteId spriteId) const
+{
+	if(spriteId >= NumSprites())
+	{
+		return Sprite();
+	}
+
+	if(mnoptrPackedSections)
+	{
+		const PackedSpriteSection& section = mnoptrPackedSections[spriteId];
+
+		Sprite sprite;
+		sprite.xPos = section.xPos;
+		sprite.yPos = section.yPos;
+		sprite.width = section.width;
+		sprite.height = section.height;
+		sprite.trimX = section.trimX;
+		sprite.trimY = section.trimY;
+		sprite.trimWidth = section.trimWidth;
+		sprite.trimHeight = section.trimHeight;
+		return sprite;
+	}
+
+	return mSections[spriteId].sprite;
 }
 
 std::vector<std::string> SpriteSheet::SpriteNames() const
 {
 	std::vector<std::string> spriteNames;
 
+	for(size_t i = 0; i < mNumPackedSections; ++i)
+	{
+		spriteNames.push_back(std::string(mnoptrPackedSections[i].key, strnlen(mnoptrPackedSections[i].key, ASSET_PACK_KEY_LENGTH)));
+	}
+
 	for(const auto& section : mSections)
 	{
 		spriteNames.push_back(section.key);
@@ -51,8 +122,58 @@ std::vector<std::string> SpriteSheet::SpriteNames() const
 	return spriteNames;
 }
 
+size_t SpriteSheet::MemorySize() const
+{
+	size_t memorySize = mBMPImage.MemorySize() + mSections.size() * sizeof(BMPImageSection) + mSpriteIds.size() * (sizeof(std::string) + sizeof(SpriteId));
+
+	for(const PaletteSwap& paletteSwap : mPaletteSwaps)
+	{
+		memorySize += paletteSwap.palette.size() * sizeof(Color);
+	}
+
+	return memorySize;
+}
+
+void SpriteSheet::BuildSpriteIds()
+{
+	mSpriteIds.clear();
+
+	std::vector<std::string> spriteNames = SpriteNames();
+	mSpriteIds.reserve(spriteNames.size());
+
+	for(size_t i = 0; i < spriteNames.size(); ++i)
+	{
+		//emplace keeps the first sprite with a given name, same as the old linear search did
+		mSpriteIds.emplace(std::move(spriteNames[i]), static_cast<SpriteId>(i));
+	}
+}
+
+bool SpriteSheet::LoadPackedSpriteSections(const std::string& name)
+{
+	SpriteSectionsTable table;
+
+	if(!FindAssetTable(name, table))
+	{
+		return false;
+	}
+
+	SetSpriteSections(table);
+
+	return true;
+}
+
+void SpriteSheet::SetSpriteSections(const SpriteSectionsTable& sections)
+{
+	mSections.clear();
+	mnoptrPackedSections = sections.sections;
+	mNumPackedSections = sections.numSections;
+}
+
 bool SpriteSheet::LoadSpriteSections(const std::string& path)
 {
+	mnoptrPackedSections = nullptr;
+	mNumPackedSections = 0;
+
 	FileCommandLoader fileLoader;
 
 	Command spriteCommand;
@@ -112,5 +233,41 @@ bool SpriteSheet::LoadSpriteSections(const std::string& path)
 		};
 	fileLoader.AddCommand(heightCommand);
 
+	Command trimXCommand;
+	trimXCommand.command = "trimX";
+
+	trimXCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			mSections.back().sprite.trimX = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(trimXCommand);
+
+	Command trimYCommand;
+	trimYCommand.command = "trimY";
+
+	trimYCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			mSections.back().sprite.trimY = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(trimYCommand);
+
+	Command trimWidthCommand;
+	trimWidthCommand.command = "trimWidth";
+
+	trimWidthCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			mSections.back().sprite.trimWidth = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(trimWidthCommand);
+
+	Command trimHeightCommand;
+	trimHeightCommand.command = "trimHeight";
+
+	trimHeightCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			mSections.back().sprite.trimHeight = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(trimHeightCommand);
+
 	return fileLoader.LoadFile(path);
 }
@@ -9,9 +9,17 @@
 #define GRAPHICS_SPRITESHEET_H_
 
 #include "BMPImage.h"
+#include "AssetTables.h"
 #include <string>
 #include <vector>
+#include <deque>
+#include <unordered_map>
 #include <stdint.h>
+#include "Utils.h"
+
+//Index of a sprite in its SpriteSheet - look it up once with GetSpriteId() and keep it
+using SpriteId = uint32_t;
+static const SpriteId INVALID_SPRITE_ID = UINT32_MAX;
 
 struct Sprite
 {
@@ -19,6 +27,18 @@ struct Sprite
 	uint32_t yPos = 0;
 	uint32_t width = 0;
 	uint32_t height = 0;
+
+	//Packed sheets (see Tools/AtlasPacker) only store the opaque part of a sprite.
+	//width and height stay the untrimmed size, the stored pixels start at xPos, yPos
+	//and sit at trimX, trimY inside that untrimmed rect.
+	uint32_t trimX = 0;
+	uint32_t trimY = 0;
+	uint32_t trimWidth = 0;
+	uint32_t trimHeight = 0;
+
+	inline bool IsTrimmed() const {return trimWidth > 0 && trimHeight > 0;}
+	inline uint32_t StoredWidth() const {return IsTrimmed() ? trimWidth : width;}
+	inline uint32_t StoredHeight() const {return IsTrimmed() ? trimHeight : height;}
 };
 
 class SpriteSheet
@@ -27,16 +47,32 @@ public:
 
 	SpriteSheet();
 	bool Load(const std::string& name);
-	Sprite GetSprite(const std::string& spriteName) const;
+	//No file I/O - the tables come from FindAssetTable() or straight from the generated embedded tables
+	bool Load(const std::string& name, const ImageTable& image, const SpriteSectionsTable& sections);
+
+	SpriteId GetSpriteId(const std::string& spriteName) const;
+	Sprite GetSprite(SpriteId spriteId) const;
+	inline Sprite GetSprite(const std::string& spriteName) const {return GetSprite(GetSpriteId(spriteName));}
+	inline size_t NumSprites() const {return mnoptrPackedSections ? mNumPackedSections : mSections.size();}
+	inline const std::string& GetName() const {return mName;}
 
 	std::vector<std::string> SpriteNames() const;
 
+	size_t MemorySize() const;
+
+	//Palette of an indexed sheet multiplied by color, built on first use and shared by every sprite
+	//drawn from this sheet. nullptr for white or non-indexed sheets.
+	const Palette* GetPaletteSwap(const Color& color) const;
+
 	inline const BMPImage& GetBMPImage() const {return mBMPImage;}
 	inline uint32_t GetWidth() const {return mBMPImage.GetWidth();}
 	inline uint32_t GetHeight() const {return mBMPImage.GetHeight();}
 private:
 
 	bool LoadSpriteSections(const std::string& path);
+	bool LoadPackedSpriteSections(const std::string& name);
+	void SetSpriteSections(const SpriteSectionsTable& sections);
+	void BuildSpriteIds();
 
 	struct BMPImageSection
 	{
@@ -44,8 +80,23 @@ private:
 		Sprite sprite;
 	};
 
+	struct PaletteSwap
+	{
+		Color color;
+		Palette palette;
+	};
+
+	std::string mName;
 	BMPImage mBMPImage;
 	std::vector<BMPImageSection> mSections;
+	std::unordered_map<std::string, SpriteId, StringCaseInsensitiveHash, StringCaseInsensitiveEqual> mSpriteIds;
+
+	//deque so handed out palettes stay put when a new color is added
+	mutable std::deque<PaletteSwap> mPaletteSwaps;
+
+	//Used instead of mSections when the sheet came from the asset pack
+	const PackedSpriteSection* mnoptrPackedSections;
+	size_t mNumPackedSections;
 };
 
 
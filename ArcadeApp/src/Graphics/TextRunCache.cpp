@@ -0,0 +1,190 @@
+/*
+ * TextRunCache.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "TextRunCache.h"
+#include "BitmapFont.h"
+#include "Screen.h"
+#include <functional>
+#include <cstring>
+#include <tuple>
+
+bool TextRunCache::RunKey::operator==(const RunKey& key) const
+{
+	return font == key.font &&
+		measureOnly == key.measureOnly &&
+		color == key.color &&
+		alpha == key.alpha &&
+		bilinearFiltering == key.bilinearFiltering &&
+		gradientX == key.gradientX &&
+		gradientY == key.gradientY &&
+		gradientColor1 == key.gradientColor1 &&
+		gradientColor2 == key.gradientColor2 &&
+		noptrPalette == key.noptrPalette &&
+		text == key.text;
+}
+
+size_t TextRunCache::HashKey(const RunKey& key)
+{
+	uint32_t alphaBits = 0;
+	memcpy(&alphaBits, &key.alpha, sizeof(alphaBits));
+
+	size_t hash = std::hash<std::string_view>()(key.text);
+	hash ^= std::hash<const void*>()(key.font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<uint64_t>()((static_cast<uint64_t>(key.color) << 32) | alphaBits) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<uint64_t>()((static_cast<uint64_t>(key.gradientColor1) << 32) | key.gradientColor2) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<const void*>()(key.noptrPalette) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= (key.measureOnly ? 1 : 0) | (key.bilinearFiltering ? 2 : 0) | (key.gradientX << 2) | (key.gradientY << 4);
+
+	return hash;
+}
+
+TextRunCache::TextRunCache()
+	: mByteBudget(DEFAULT_BYTE_BUDGET)
+	, mBytesUsed(0)
+{
+
+}
+
+void TextRunCache::SetByteBudget(size_t byteBudget)
+{
+	mByteBudget = byteBudget;
+	EvictToBudget(nullptr);
+}
+
+const Size& TextRunCache::GetSizeOf(const BitmapFont& font, const std::string& text)
+{
+	RunKey key;
+	key.font = &font;
+	key.text = text;
+	key.measureOnly = true;
+
+	bool added = false;
+	RunEntry& entry = FindOrAdd(key, font, added);
+
+	if (added)
+	{
+		EvictToBudget(&entry);
+	}
+
+	return entry.size;
+}
+
+const ScreenBuffer& TextRunCache::GetRun(Screen& screen, const BitmapFont& font, const std::string& text, const ColorParams& colorParams)
+{
+	RunKey key;
+	key.font = &font;
+	key.text = text;
+	key.color = colorParams.overlay.GetPixelColor();
+	key.alpha = colorParams.alpha;
+	key.bilinearFiltering = colorParams.bilinearFiltering;
+	key.gradientX = colorParams.gradient.xParam;
+	key.gradientY = colorParams.gradient.yParam;
+	key.gradientColor1 = colorParams.gradient.color1.GetPixelColor();
+	key.gradientColor2 = colorParams.gradient.color2.GetPixelColor();
+	key.noptrPalette = colorParams.palette;
+	key.measureOnly = false;
+
+	bool added = false;
+	RunEntry& entry = FindOrAdd(key, font, added);
+
+	if (added)
+	{
+		//Empty strings still get a 1x1 buffer so there's always a valid surface to blit
+		uint32_t width = entry.size.width > 0 ? entry.size.width : 1;
+		uint32_t height = entry.size.height > 0 ? entry.size.height : 1;
+
+		screen.InitRenderTarget(entry.run, width, height);
+
+		ScreenBuffer* previousTarget = screen.GetRenderTarget();
+		screen.SetRenderTarget(&entry.run);
+
+		DrawTransform transform;
+		screen.Draw(font, text, transform, colorParams, UVParams());
+
+		screen.SetRenderTarget(previousTarget);
+
+		size_t runBytes = static_cast<size_t>(width) * height * sizeof(uint32_t);
+		entry.bytes += runBytes;
+		mBytesUsed += runBytes;
+
+		EvictToBudget(&entry);
+	}
+
+	return entry.run;
+}
+
+void TextRunCache::Clear()
+{
+	mEntries.clear();
+	mLRU.clear();
+	mBytesUsed = 0;
+}
+
+TextRunCache::RunEntry& TextRunCache::FindOrAdd(const RunKey& key, const BitmapFont& font, bool& added)
+{
+	const size_t hash = HashKey(key);
+	auto range = mEntries.equal_range(hash);
+
+	for (auto iter = range.first; iter != range.second; ++iter)
+	{
+		if (iter->second.key == key)
+		{
+			added = false;
+			Touch(iter->second);
+			return iter->second;
+		}
+	}
+
+	added = true;
+
+	//Only a new entry copies the text
+	RunEntry& entry = mEntries.emplace(std::piecewise_construct, std::forward_as_tuple(hash), std::forward_as_tuple())->second;
+	entry.text.assign(key.text.data(), key.text.size());
+	entry.key = key;
+	entry.key.text = entry.text;
+	entry.hash = hash;
+	entry.size = font.GetSizeOf(entry.text);
+	entry.bytes = sizeof(RunEntry) + entry.text.capacity();
+
+	mLRU.push_front(&entry);
+	entry.lruIter = mLRU.begin();
+
+	mBytesUsed += entry.bytes;
+
+	return entry;
+}
+
+void TextRunCache::Touch(RunEntry& entry)
+{
+	mLRU.splice(mLRU.begin(), mLRU, entry.lruIter);
+}
+
+void TextRunCache::Erase(RunEntry& entry)
+{
+	mBytesUsed -= entry.bytes;
+	mLRU.erase(entry.lruIter);
+
+	auto range = mEntries.equal_range(entry.hash);
+
+	for (auto iter = range.first; iter != range.second; ++iter)
+	{
+		if (&iter->second == &entry)
+		{
+			mEntries.erase(iter);
+			return;
+		}
+	}
+}
+
+void TextRunCache::EvictToBudget(const RunEntry* noptrKeep)
+{
+	//Never evict what was just asked for, even if it's bigger than the whole budget on its own
+	while (mBytesUsed > mByteBudget && !mLRU.empty() && mLRU.back() != noptrKeep)
+	{
+		Erase(*mLRU.back());
+	}
+}
@@ -0,0 +1,99 @@
+/*
+ * TextRunCache.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef GRAPHICS_TEXTRUNCACHE_H_
+#define GRAPHICS_TEXTRUNCACHE_H_
+
+#include "ScreenBuffer.h"
+#include "Utils.h"
+#include <string>
+#include <string_view>
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <stdint.h>
+
+class BitmapFont;
+class Screen;
+class Color;
+struct ColorParams;
+
+//Caches the measured size of strings and pre-rasterized runs of text so static strings
+//cost a hash lookup to measure and one blit to draw. Least recently used entries are
+//evicted once the cache goes over its byte budget.
+class TextRunCache
+{
+public:
+
+	static const size_t DEFAULT_BYTE_BUDGET = 512 * 1024;
+
+	TextRunCache();
+
+	void SetByteBudget(size_t byteBudget);
+	inline size_t GetByteBudget() const {return mByteBudget;}
+	inline size_t GetBytesUsed() const {return mBytesUsed;}
+
+	const Size& GetSizeOf(const BitmapFont& font, const std::string& text);
+
+	//Returns the run rasterized with the color params, rendering it first if it isn't cached
+	const ScreenBuffer& GetRun(Screen& screen, const BitmapFont& font, const std::string& text, const ColorParams& colorParams);
+
+	void Clear();
+
+private:
+
+	//Doesn't own its text - a lookup points it at the caller's string, a stored entry at its own copy
+	struct RunKey
+	{
+		const BitmapFont* font = nullptr;
+		std::string_view text;
+		uint32_t color = 0;
+		float alpha = 1.0f;
+		bool bilinearFiltering = false;
+		int gradientX = 0;
+		int gradientY = 0;
+		uint32_t gradientColor1 = 0;
+		uint32_t gradientColor2 = 0;
+		const std::vector<Color>* noptrPalette = nullptr; //by address - the palette swaps a SpriteSheet hands out stay put
+		bool measureOnly = true;
+
+		bool operator==(const RunKey& key) const;
+	};
+
+	struct RunEntry
+	{
+		RunKey key;
+		std::string text; //what key.text points at, entries never move once they're in the map
+		size_t hash = 0;
+		Size size;
+		ScreenBuffer run;
+		size_t bytes = 0;
+		std::list<RunEntry*>::iterator lruIter;
+	};
+
+	struct IdentityHash
+	{
+		inline size_t operator()(size_t hash) const {return hash;}
+	};
+
+	//Keyed by the RunKey's hash so finding an entry never builds a key that owns its text
+	using RunMap = std::unordered_multimap<size_t, RunEntry, IdentityHash>;
+
+	static size_t HashKey(const RunKey& key);
+
+	RunEntry& FindOrAdd(const RunKey& key, const BitmapFont& font, bool& added);
+	void Touch(RunEntry& entry);
+	void Erase(RunEntry& entry);
+	void EvictToBudget(const RunEntry* noptrKeep);
+
+	RunMap mEntries;
+	std::list<RunEntry*> mLRU; //most recently used at the front
+	size_t mByteBudget;
+	size_t mBytesUsed;
+};
+
+#endif /* GRAPHICS_TEXTRUNCACHE_H_ */
@@ -61,8 +61,19 @@ void InputController::Update(uint32_t dt)
 			break;
 		case SDL_KEYDOWN:
 		case SDL_KEYUP:
+		{
+			bool handled = false;
 
-			if(mnoptrCurrentController)
+			for(const ButtonAction& globalAction : mGlobalKeyActions)
+			{
+				if(globalAction.key == sdlEvent.key.keysym.sym)
+				{
+					globalAction.action(dt, static_cast<InputState>(sdlEvent.key.state));
+					handled = true;
+				}
+			}
+
+			if(!handled && mnoptrCurrentController)
 			{
 				InputAction action = mnoptrCurrentController->GetActionForKey(sdlEvent.key.keysym.sym);
 
@@ -70,6 +81,7 @@ void InputController::Update(uint32_t dt)
 			}
 			break;
 		}
+		}
 	}
 }
 
@@ -77,3 +89,8 @@ void InputController::SetGameController(GameController* controller)
 {
 	mnoptrCurrentController = controller;
 }
+
+void InputController::AddGlobalKeyAction(const ButtonAction& buttonAction)
+{
+	mGlobalKeyActions.push_back(buttonAction);
+}
@@ -9,6 +9,7 @@
 #define INPUT_INPUTCONTROLLER_H_
 
 #include "InputAction.h"
+#include <vector>
 
 class GameController;
 
@@ -20,9 +21,12 @@ public:
 	void Init(InputAction quitAction);
 	void Update(uint32_t dt);
 	void SetGameController(GameController* controller);
+	//Keys the App handles whatever scene is up, they never reach the game controller
+	void AddGlobalKeyAction(const ButtonAction& buttonAction);
 
 private:
 	InputAction mQuit;
+	std::vector<ButtonAction> mGlobalKeyActions;
 	GameController* mnoptrCurrentController;
 };
 
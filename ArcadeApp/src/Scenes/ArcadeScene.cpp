@@ -11,6 +11,7 @@
 #include <iostream>
 #include "App.h"
 #include "GameScene.h"
+#include "LoadingScene.h"
 #include "BreakOut.h"
 #include "AsteroidsGame.h"
 #include "NotImplementedScene.h"
@@ -80,7 +81,7 @@ std::unique_ptr<Scene> ArcadeScene::GetScene(eGame game)
 
 			std::unique_ptr<GameScene> breakoutScene = std::make_unique<GameScene>(std::move(breakoutGame));
 
-			return breakoutScene;
+			return std::make_unique<LoadingScene>(std::move(breakoutScene));
 		}
 		break;
 
@@ -90,7 +91,7 @@ std::unique_ptr<Scene> ArcadeScene::GetScene(eGame game)
 
 			std::unique_ptr<GameScene> asteroidsScene = std::make_unique<GameScene>(std::move(asteroidsGame));
 
-			return asteroidsScene;
+			return std::make_unique<LoadingScene>(std::move(asteroidsScene));
 		}
 		break;
 
@@ -8,14 +8,30 @@
 
 #include "GameScene.h"
 #include "Screen.h"
+#include "AssetLoader.h"
+#include "App.h"
 
-GameScene::GameScene(std::unique_ptr<Game> optrGame):mGame(std::move(optrGame))
+GameScene::GameScene(std::unique_ptr<Game> optrGame):mGame(std::move(optrGame)), mAssetsQueued(false)
 {
 
 }
 
+void GameScene::LoadAssets(AssetLoader& loader)
+{
+	mGame->LoadAssets(loader);
+	mAssetsQueued = true;
+}
+
 void GameScene::Init()
 {
+	//Pushed directly instead of through a LoadingScene - still loads in parallel, just blocks until it's done
+	if(!mAssetsQueued)
+	{
+		AssetLoader loader(App::Singleton().GetThreadPool());
+		LoadAssets(loader);
+		loader.Wait();
+	}
+
 	mGame->Init(mGameController);
 }
 
@@ -32,6 +48,7 @@ void GameScene::Draw(Screen& screen)
 void GameScene::Shutdown(Screen& theScreen)
 {
 	theScreen.ClearBackground();
+	theScreen.ClearHUDElements();
 }
 
 const std::string& GameScene::GetSceneName() const
@@ -18,6 +18,7 @@ public:
 
 	GameScene(std::unique_ptr<Game> optrGame);
 	virtual ~GameScene() {}
+	virtual void LoadAssets(AssetLoader& loader) override;
 	virtual void Init() override;
 	virtual void Update(uint32_t dt) override;
 	virtual void Draw(Screen& screen) override;
@@ -26,6 +27,7 @@ public:
 
 private:
 	std::unique_ptr<Game> mGame;
+	bool mAssetsQueued;
 };
 
 #endif /* SCENES_GAMESCENE_H_ */
@@ -0,0 +1,75 @@
+/*
+ * LoadingScene.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "LoadingScene.h"
+#include "App.h"
+#include "AARectangle.h"
+#include "Screen.h"
+#include <cassert>
+
+namespace
+{
+	const std::string LOADING_STR = "Loading";
+	const uint32_t DOT_TIME = 300; //in milliseconds
+	const uint32_t NUM_DOTS = 3;
+	const uint32_t PROGRESS_BAR_WIDTH = 100;
+	const uint32_t PROGRESS_BAR_HEIGHT = 6;
+}
+
+LoadingScene::LoadingScene(std::unique_ptr<Scene> optrNextScene):
+	mNextScene(std::move(optrNextScene)),
+	mAssetLoader(App::Singleton().GetThreadPool()),
+	mElapsedTime(0)
+{
+	assert(mNextScene && "Need a scene to load");
+}
+
+void LoadingScene::Init()
+{
+	mNextScene->LoadAssets(mAssetLoader);
+}
+
+void LoadingScene::Update(uint32_t dt)
+{
+	mElapsedTime += dt;
+
+	if(mNextScene && mAssetLoader.IsDone())
+	{
+		App::Singleton().ReplaceTopScene(std::move(mNextScene));
+	}
+}
+
+void LoadingScene::Draw(Screen& theScreen)
+{
+	const BitmapFont& font = App::Singleton().GetFont();
+
+	AARectangle rect = {Vec2D::Zero, App::Singleton().Width(), App::Singleton().Height()};
+
+	//Position off the full string so the text doesn't shift as the dots come and go
+	Size textSize = font.GetSizeOf(LOADING_STR + std::string(NUM_DOTS, '.'));
+	Vec2D textDrawPosition = font.GetDrawPosition(textSize, rect, BFXA_CENTER, BFYA_CENTER);
+
+	std::string loadingStr = LOADING_STR + std::string((mElapsedTime / DOT_TIME) % (NUM_DOTS + 1), '.');
+
+	theScreen.Draw(font, loadingStr, textDrawPosition, Color::White());
+
+	Vec2D barPosition = Vec2D(static_cast<float>(App::Singleton().Width() - PROGRESS_BAR_WIDTH) / 2.0f, textDrawPosition.GetY() + static_cast<float>(textSize.height * 2));
+	uint32_t progressWidth = static_cast<uint32_t>(mAssetLoader.Progress() * static_cast<float>(PROGRESS_BAR_WIDTH));
+
+	if(progressWidth > 0)
+	{
+		theScreen.Draw(AARectangle(barPosition, progressWidth, PROGRESS_BAR_HEIGHT), Color::White(), true, Color::White());
+	}
+
+	theScreen.Draw(AARectangle(barPosition, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT), Color::White());
+}
+
+const std::string& LoadingScene::GetSceneName() const
+{
+	static std::string name = "Loading";
+	return name;
+}
@@ -0,0 +1,35 @@
+/*
+ * LoadingScene.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef SCENES_LOADINGSCENE_H_
+#define SCENES_LOADINGSCENE_H_
+
+#include "Scene.h"
+#include "AssetLoader.h"
+#include <memory>
+
+class Screen;
+
+//Keeps drawing frames while the next scene's assets load on the ThreadPool,
+//then swaps itself out for that scene.
+class LoadingScene: public Scene
+{
+public:
+	LoadingScene(std::unique_ptr<Scene> optrNextScene);
+	virtual void Init() override;
+	virtual void Update(uint32_t dt) override;
+	virtual void Draw(Screen& theScreen) override;
+	virtual const std::string& GetSceneName() const override;
+
+private:
+	//Declared before the loader so the loader waits on its jobs before the scene they write into goes away
+	std::unique_ptr<Scene> mNextScene;
+	AssetLoader mAssetLoader;
+	uint32_t mElapsedTime;
+};
+
+#endif /* SCENES_LOADINGSCENE_H_ */
@@ -11,6 +11,7 @@
 #include "App.h"
 #include "NotImplementedScene.h"
 #include "GameScene.h"
+#include "LoadingScene.h"
 #include "PacmanGame.h"
 #include <vector>
 #include <memory>
@@ -39,7 +40,7 @@ void PacmanStartScene::Init()
 
 	actions.push_back([](){
 		auto pacmanGame = std::make_unique<PacmanGame>();
-		App::Singleton().PushScene(std::make_unique<GameScene>(std::move(pacmanGame)));
+		App::Singleton().PushScene(std::make_unique<LoadingScene>(std::make_unique<GameScene>(std::move(pacmanGame))));
 	});
 
 	actions.push_back([](){
@@ -13,12 +13,15 @@
 #include "GameController.h"
 
 class Screen;
+class AssetLoader;
 
 //Interface
 class Scene
 {
 public:
 	virtual ~Scene() {}
+	//Queue up whatever Init() needs loaded - runs before Init(), off the main thread when pushed through a LoadingScene
+	virtual void LoadAssets(AssetLoader& loader) {}
 	virtual void Init() = 0;
 	virtual void Update(uint32_t dt) = 0;
 	virtual void Draw(Screen& theScreen) = 0;
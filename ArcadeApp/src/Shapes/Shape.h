@@ -14,6 +14,13 @@
 class Shape
 {
 public:
+	//The virtual destructor would otherwise turn every move of a shape (and of what holds one) into a copy
+	Shape() = default;
+	Shape(const Shape& other) = default;
+	Shape(Shape&& other) noexcept = default;
+	Shape& operator=(const Shape& other) = default;
+	Shape& operator=(Shape&& other) noexcept = default;
+
 	virtual Vec2D GetCenterPoint() const = 0;
 	virtual ~Shape() {}
 	inline virtual std::vector<Vec2D> GetPoints() const {return mPoints;}
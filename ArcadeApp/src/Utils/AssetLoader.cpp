@@ -0,0 +1,123 @@
+/*
+ * AssetLoader.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AssetLoader.h"
+#include "ThreadPool.h"
+#include "BMPImage.h"
+#include "SpriteSheet.h"
+#include "App.h"
+#include <iostream>
+#include <chrono>
+
+namespace
+{
+	bool IsReady(const std::shared_future<bool>& job)
+	{
+		return job.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+}
+
+AssetLoader::AssetLoader(ThreadPool& threadPool): mThreadPool(threadPool)
+{
+
+}
+
+AssetLoader::~AssetLoader()
+{
+	Wait();
+}
+
+std::shared_future<bool> AssetLoader::Load(std::shared_ptr<const BMPImage>& image, const std::string& path)
+{
+	return Queue(path, [&image, path]{
+		image = App::Singleton().GetAssetManager().GetImage(path);
+		return image != nullptr;
+	});
+}
+
+std::shared_future<bool> AssetLoader::Load(std::shared_ptr<const SpriteSheet>& spriteSheet, const std::string& name, const std::vector<std::string>& animationsPaths)
+{
+	return Queue(name, [&spriteSheet, name, animationsPaths]{
+		spriteSheet = App::Singleton().GetAssetManager().GetSpriteSheet(name);
+
+		if(!spriteSheet)
+		{
+			return false;
+		}
+
+		bool loaded = true;
+
+		AnimationLibrary& animationLibrary = App::Singleton().GetAnimationLibrary();
+
+		for(const std::string& animationsPath : animationsPaths)
+		{
+			loaded = animationLibrary.GetAnimations(animationsPath, spriteSheet.get()) != nullptr && loaded;
+		}
+
+		return loaded;
+	});
+}
+
+std::shared_future<bool> AssetLoader::Queue(const std::string& description, std::function<bool()> job)
+{
+	std::shared_future<bool> result = mThreadPool.Submit([description, job = std::move(job)]{
+		bool loaded = job();
+
+		if(!loaded)
+		{
+			std::cout << "Could not load: " << description << std::endl;
+		}
+
+		return loaded;
+	}).share();
+
+	mJobs.push_back(result);
+
+	return result;
+}
+
+bool AssetLoader::IsDone() const
+{
+	return NumFinished() == mJobs.size();
+}
+
+size_t AssetLoader::NumFinished() const
+{
+	size_t numFinished = 0;
+
+	for(const auto& job : mJobs)
+	{
+		if(IsReady(job))
+		{
+			++numFinished;
+		}
+	}
+
+	return numFinished;
+}
+
+float AssetLoader::Progress() const
+{
+	if(mJobs.empty())
+	{
+		return 1.0f;
+	}
+
+	return static_cast<float>(NumFinished()) / static_cast<float>(mJobs.size());
+}
+
+bool AssetLoader::Wait()
+{
+	bool loaded = true;
+
+	for(const auto& job : mJobs)
+	{
+		loaded = job.get() && loaded;
+	}
+
+	return loaded;
+}
@@ -0,0 +1,54 @@
+/*
+ * AssetLoader.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ASSETLOADER_H_
+#define UTILS_ASSETLOADER_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <future>
+#include <memory>
+
+class ThreadPool;
+class BMPImage;
+class SpriteSheet;
+
+//One batch of asset loads run on the ThreadPool, going through the App's AssetManager so anything
+//already decoded is handed straight back. The pointers handed in are written to from the
+//workers so leave them alone until IsDone() - the destructor waits for anything still running.
+class AssetLoader
+{
+public:
+	explicit AssetLoader(ThreadPool& threadPool);
+	~AssetLoader();
+
+	AssetLoader(const AssetLoader&) = delete;
+	AssetLoader& operator=(const AssetLoader&) = delete;
+
+	std::shared_future<bool> Load(std::shared_ptr<const BMPImage>& image, const std::string& path);
+
+	//The animations are parsed and resolved against the sheet in the same job, once it's loaded
+	std::shared_future<bool> Load(std::shared_ptr<const SpriteSheet>& spriteSheet, const std::string& name, const std::vector<std::string>& animationsPaths = {});
+
+	//Anything else, ie. level files. description is what gets printed if the job returns false
+	std::shared_future<bool> Queue(const std::string& description, std::function<bool()> job);
+
+	bool IsDone() const;
+	size_t NumQueued() const {return mJobs.size();}
+	size_t NumFinished() const;
+	float Progress() const;
+
+	//Blocks until everything queued is done, returns false if any load failed
+	bool Wait();
+
+private:
+	ThreadPool& mThreadPool;
+	std::vector<std::shared_future<bool>> mJobs;
+};
+
+#endif /* UTILS_ASSETLOADER_H_ */
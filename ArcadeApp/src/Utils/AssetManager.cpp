@@ -0,0 +1,188 @@
+/*
+ * AssetManager.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AssetManager.h"
+#include "BMPImage.h"
+#include "SpriteSheet.h"
+#include "AssetPack.h"
+
+namespace
+{
+	//"assets/PacmanSprites.bmp" -> "PacmanSprites"
+	std::string AssetStem(const std::string& path)
+	{
+		std::string name = AssetPack::AssetName(path);
+		size_t extensionPos = name.find_last_of('.');
+
+		return extensionPos == std::string::npos ? name : name.substr(0, extensionPos);
+	}
+}
+
+size_t AssetMemorySize(const BMPImage& image)
+{
+	return sizeof(BMPImage) + image.MemorySize();
+}
+
+size_t AssetMemorySize(const SpriteSheet& spriteSheet)
+{
+	return sizeof(SpriteSheet) + spriteSheet.MemorySize();
+}
+
+AssetManager::AssetManager(size_t memoryBudget): mUseCounter(0)
+{
+	mStats.memoryBudget = memoryBudget;
+}
+
+std::shared_ptr<const BMPImage> AssetManager::GetImage(const std::string& path)
+{
+	return Get<BMPImage>(path, [path](BMPImage& image){
+		return image.Load(path);
+	});
+}
+
+std::shared_ptr<const SpriteSheet> AssetManager::GetSpriteSheet(const std::string& name)
+{
+	return Get<SpriteSheet>(name, [name](SpriteSheet& spriteSheet){
+		return spriteSheet.Load(name);
+	});
+}
+
+void AssetManager::SetMemoryBudget(size_t memoryBudget)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mStats.memoryBudget = memoryBudget;
+	EvictToBudget(memoryBudget);
+}
+
+void AssetManager::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	EvictToBudget(0);
+}
+
+size_t AssetManager::Reload(const std::string& fileName)
+{
+	const std::string stem = AssetStem(fileName);
+	std::vector<std::pair<AssetKey, ReloadFunc>> toReload;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		for(const auto& asset : mAssets)
+		{
+			if(asset.second.reload && AssetStem(asset.first.second) == stem)
+			{
+				toReload.emplace_back(asset.first, asset.second.reload);
+			}
+		}
+	}
+
+	size_t numReloaded = 0;
+
+	//Outside the lock, they read files - same as Get()
+	for(const auto& reload : toReload)
+	{
+		size_t memorySize = reload.second();
+
+		if(memorySize == 0)
+		{
+			continue;
+		}
+
+		++numReloaded;
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto iter = mAssets.find(reload.first);
+
+		if(iter != mAssets.end())
+		{
+			mStats.memoryUsed = mStats.memoryUsed - iter->second.memorySize + memorySize;
+			iter->second.memorySize = memorySize;
+		}
+	}
+
+	return numReloaded;
+}
+
+AssetManagerStats AssetManager::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	AssetManagerStats stats = mStats;
+	stats.numAssets = mAssets.size();
+
+	return stats;
+}
+
+std::shared_ptr<const void> AssetManager::Find(const AssetKey& key)
+{
+	auto iter = mAssets.find(key);
+
+	if(iter == mAssets.end())
+	{
+		++mStats.misses;
+		return nullptr;
+	}
+
+	++mStats.hits;
+	iter->second.lastUsed = ++mUseCounter;
+
+	return iter->second.asset;
+}
+
+std::shared_ptr<const void> AssetManager::Insert(const AssetKey& key, std::shared_ptr<const void> asset, size_t memorySize, ReloadFunc reload)
+{
+	auto result = mAssets.emplace(key, AssetEntry());
+
+	//Another thread loaded the same asset while we were - keep the one that's already been handed out
+	if(result.second)
+	{
+		result.first->second.asset = std::move(asset);
+		result.first->second.memorySize = memorySize;
+		result.first->second.reload = std::move(reload);
+		mStats.memoryUsed += memorySize;
+	}
+
+	result.first->second.lastUsed = ++mUseCounter;
+
+	std::shared_ptr<const void> inserted = result.first->second.asset;
+
+	EvictToBudget(mStats.memoryBudget);
+
+	return inserted;
+}
+
+void AssetManager::EvictToBudget(size_t memoryBudget)
+{
+	while(mStats.memoryUsed > memoryBudget)
+	{
+		//Linear search - there are only ever a handful of assets
+		auto leastRecentlyUsed = mAssets.end();
+
+		for(auto iter = mAssets.begin(); iter != mAssets.end(); ++iter)
+		{
+			//The manager's own reference is the only one left
+			if(iter->second.asset.use_count() == 1 &&
+			   (leastRecentlyUsed == mAssets.end() || iter->second.lastUsed < leastRecentlyUsed->second.lastUsed))
+			{
+				leastRecentlyUsed = iter;
+			}
+		}
+
+		if(leastRecentlyUsed == mAssets.end())
+		{
+			//Everything left is in use, the budget is a soft limit
+			return;
+		}
+
+		mStats.memoryUsed -= leastRecentlyUsed->second.memorySize;
+		++mStats.evictions;
+		mAssets.erase(leastRecentlyUsed);
+	}
+}
@@ -0,0 +1,188 @@
+/*
+ * AssetManager.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ASSETMANAGER_H_
+#define UTILS_ASSETMANAGER_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <typeindex>
+#include <stddef.h>
+#include <stdint.h>
+#include "Profiler.h"
+
+class BMPImage;
+class SpriteSheet;
+
+struct AssetManagerStats
+{
+	uint32_t hits = 0;
+	uint32_t misses = 0;
+	uint32_t evictions = 0;
+	size_t numAssets = 0;
+	size_t memoryUsed = 0;
+	size_t memoryBudget = 0;
+};
+
+//How much memory an asset counts against the budget - add an overload, next to the type, for anything that
+//holds more than its sizeof. Containers count their elements through these too.
+size_t AssetMemorySize(const BMPImage& image);
+size_t AssetMemorySize(const SpriteSheet& spriteSheet);
+
+template<typename Asset>
+size_t AssetMemorySize(const Asset& asset)
+{
+	return sizeof(Asset);
+}
+
+inline size_t AssetMemorySize(const std::string& text)
+{
+	return sizeof(std::string) + text.capacity();
+}
+
+template<typename Element>
+size_t AssetMemorySize(const std::vector<Element>& elements)
+{
+	//Each element counts its sizeof, the spare capacity is only its sizeof
+	size_t memorySize = sizeof(std::vector<Element>) + (elements.capacity() - elements.size()) * sizeof(Element);
+
+	for(const Element& element : elements)
+	{
+		memorySize += AssetMemorySize(element);
+	}
+
+	return memorySize;
+}
+
+//Owned by the App, keeps decoded assets around between scenes so going back into a game doesn't hit the disk.
+//Assets are handed out as shared_ptrs - while anyone holds one it's never evicted. Once the total is over
+//the memory budget the least recently used assets nobody holds are dropped.
+//Safe to use from the AssetLoader's worker threads.
+class AssetManager
+{
+public:
+	static const size_t DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+	explicit AssetManager(size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+	AssetManager(const AssetManager&) = delete;
+	AssetManager& operator=(const AssetManager&) = delete;
+
+	//nullptr if it couldn't be loaded
+	std::shared_ptr<const BMPImage> GetImage(const std::string& path);
+	std::shared_ptr<const SpriteSheet> GetSpriteSheet(const std::string& name);
+
+	//For anything else, ie. level data. load fills in a default constructed Asset and returns false if it failed.
+	//load is kept to reload the asset when its file changes, capture by value.
+	template<typename Asset, typename LoadFunc>
+	std::shared_ptr<const Asset> Get(const std::string& key, LoadFunc&& load);
+
+	//nullptr unless it's loaded already, never loads it
+	template<typename Asset>
+	std::shared_ptr<const Asset> FindLoaded(const std::string& key);
+
+	//Hot reload - loads every asset whose key names fileName again ("PacmanSprites" and "assets/PacmanSprites.bmp"
+	//both go with "PacmanSprites.txt") and swaps the new data into the existing object, so whoever holds it sees
+	//the change. Main thread only, between frames. Returns how many assets were reloaded.
+	size_t Reload(const std::string& fileName);
+
+	void SetMemoryBudget(size_t memoryBudget);
+	//Drops every asset nobody holds
+	void Clear();
+
+	AssetManagerStats GetStats() const;
+
+private:
+	using AssetKey = std::pair<std::type_index, std::string>;
+
+	//Loads the asset again in place, returns its new memory size or 0 if it failed
+	using ReloadFunc = std::function<size_t()>;
+
+	struct AssetEntry
+	{
+		std::shared_ptr<const void> asset;
+		size_t memorySize = 0;
+		uint64_t lastUsed = 0;
+		ReloadFunc reload;
+	};
+
+	//nullptr on a miss, must hold mMutex
+	std::shared_ptr<const void> Find(const AssetKey& key);
+	std::shared_ptr<const void> Insert(const AssetKey& key, std::shared_ptr<const void> asset, size_t memorySize, ReloadFunc reload);
+	void EvictToBudget(size_t memoryBudget);
+
+	std::map<AssetKey, AssetEntry> mAssets;
+	AssetManagerStats mStats;
+	uint64_t mUseCounter;
+	mutable std::mutex mMutex;
+};
+
+template<typename Asset, typename LoadFunc>
+std::shared_ptr<const Asset> AssetManager::Get(const std::string& key, LoadFunc&& load)
+{
+	AssetKey assetKey(std::type_index(typeid(Asset)), key);
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		if(std::shared_ptr<const void> asset = Find(assetKey))
+		{
+			return std::static_pointer_cast<const Asset>(asset);
+		}
+	}
+
+	//Load outside the lock so different assets load in parallel
+	std::shared_ptr<Asset> asset = std::make_shared<Asset>();
+
+	{
+		PROFILE_ZONE("AssetLoad");
+
+		if(!load(*asset))
+		{
+			return nullptr;
+		}
+	}
+
+	size_t memorySize = AssetMemorySize(static_cast<const Asset&>(*asset));
+
+	//Holds the asset weakly - the manager's entry owns it, evicting it shouldn't depend on this
+	std::weak_ptr<Asset> weakAsset = asset;
+	ReloadFunc reload = [weakAsset, load]() -> size_t {
+		std::shared_ptr<Asset> reloadedAsset = weakAsset.lock();
+		Asset reloaded;
+
+		if(!reloadedAsset || !load(reloaded))
+		{
+			return 0;
+		}
+
+		*reloadedAsset = std::move(reloaded);
+
+		return AssetMemorySize(static_cast<const Asset&>(*reloadedAsset));
+	};
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	return std::static_pointer_cast<const Asset>(Insert(assetKey, std::move(asset), memorySize, std::move(reload)));
+}
+
+template<typename Asset>
+std::shared_ptr<const Asset> AssetManager::FindLoaded(const std::string& key)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto iter = mAssets.find(AssetKey(std::type_index(typeid(Asset)), key));
+
+	return iter == mAssets.end() ? nullptr : std::static_pointer_cast<const Asset>(iter->second.asset);
+}
+
+#endif /* UTILS_ASSETMANAGER_H_ */
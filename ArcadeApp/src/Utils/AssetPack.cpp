@@ -0,0 +1,435 @@
+/*
+ * AssetPack.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AssetPack.h"
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+AssetPack::AssetPack():
+	mnoptrData(nullptr),
+	mSize(0),
+	mnoptrEntries(nullptr),
+	mNumEntries(0),
+#ifdef _WIN32
+	mFileHandle(INVALID_HANDLE_VALUE),
+	mMappingHandle(nullptr)
+#else
+	mFileDescriptor(-1)
+#endif
+{
+
+}
+
+AssetPack::~AssetPack()
+{
+	Close();
+}
+
+bool AssetPack::Open(const std::string& path)
+{
+	Close();
+
+#ifdef _WIN32
+	mFileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if(mFileHandle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if(!GetFileSizeEx(mFileHandle, &fileSize) || fileSize.QuadPart == 0)
+	{
+		Close();
+		return false;
+	}
+
+	mMappingHandle = CreateFileMappingA(mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if(mMappingHandle == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	mnoptrData = static_cast<const uint8_t*>(MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+	mSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+	mFileDescriptor = open(path.c_str(), O_RDONLY);
+
+	if(mFileDescriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+
+	if(fstat(mFileDescriptor, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		Close();
+		return false;
+	}
+
+	void* mapped = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+
+	if(mapped != MAP_FAILED)
+	{
+		mnoptrData = static_cast<const uint8_t*>(mapped);
+		mSize = static_cast<size_t>(fileStat.st_size);
+	}
+#endif
+
+	if(mnoptrData == nullptr)
+	{
+		std::cout << "Could not map the asset pack: " << path << std::endl;
+		Close();
+		return false;
+	}
+
+	if(!Validate())
+	{
+		std::cout << "Ignoring the asset pack: " << path << " - it is not a version " << ASSET_PACK_VERSION << " pack, rebuild it with AssetPacker" << std::endl;
+		Close();
+		return false;
+	}
+
+	const AssetPackHeader* header = reinterpret_cast<const AssetPackHeader*>(mnoptrData);
+	mnoptrEntries = reinterpret_cast<const AssetPackEntry*>(mnoptrData + header->entriesOffset);
+	mNumEntries = header->numEntries;
+	mPath = path;
+
+	return true;
+}
+
+void AssetPack::Close()
+{
+#ifdef _WIN32
+	if(mnoptrData)
+	{
+		UnmapViewOfFile(mnoptrData);
+	}
+
+	if(mMappingHandle)
+	{
+		CloseHandle(mMappingHandle);
+		mMappingHandle = nullptr;
+	}
+
+	if(mFileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(mFileHandle);
+		mFileHandle = INVALID_HANDLE_VALUE;
+	}
+#else
+	if(mnoptrData)
+	{
+		munmap(const_cast<uint8_t*>(mnoptrData), mSize);
+	}
+
+	if(mFileDescriptor >= 0)
+	{
+		close(mFileDescriptor);
+		mFileDescriptor = -1;
+	}
+#endif
+
+	mnoptrData = nullptr;
+	mSize = 0;
+	mnoptrEntries = nullptr;
+	mNumEntries = 0;
+	mPath.clear();
+}
+
+std::vector<std::string> AssetPack::FindStaleEntries(const std::string& directory) const
+{
+	std::vector<std::string> staleNames;
+
+	std::error_code error;
+	const std::filesystem::file_time_type packTime = std::filesystem::last_write_time(mPath, error);
+
+	if(error)
+	{
+		return staleNames;
+	}
+
+	for(uint32_t i = 0; i < mNumEntries; ++i)
+	{
+		const AssetPackEntry& entry = mnoptrEntries[i];
+		const std::string name(entry.name, strnlen(entry.name, ASSET_PACK_NAME_LENGTH));
+		const std::string path = directory + name;
+
+		const uintmax_t fileSize = std::filesystem::file_size(path, error);
+
+		if(error)
+		{
+			continue;
+		}
+
+		if(static_cast<uint64_t>(fileSize) != entry.sourceSize)
+		{
+			staleNames.push_back(name);
+			continue;
+		}
+
+		//Older than the pack, it's what was packed. Only a file saved after that with the
+		//same size is read through - a build copying the assets next to the pack can put it here too.
+		const std::filesystem::file_time_type fileTime = std::filesystem::last_write_time(path, error);
+
+		if(error || fileTime < packTime)
+		{
+			continue;
+		}
+
+		std::ifstream inFile(path, std::ios::binary);
+
+		if(!inFile.is_open())
+		{
+			continue;
+		}
+
+		std::vector<uint8_t> contents((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+
+		if(AssetPackHash(contents.data(), contents.size()) != entry.sourceHash)
+		{
+			staleNames.push_back(name);
+		}
+	}
+
+	return staleNames;
+}
+
+const uint8_t* AssetPack::Find(const std::string& name, AssetPackEntryType type, size_t& size) const
+{
+	size = 0;
+
+	if(!IsOpen() || name.length() > ASSET_PACK_NAME_LENGTH)
+	{
+		return nullptr;
+	}
+
+	for(uint32_t i = 0; i < mNumEntries; ++i)
+	{
+		const AssetPackEntry& entry = mnoptrEntries[i];
+
+		if(entry.type == type && strncmp(entry.name, name.c_str(), ASSET_PACK_NAME_LENGTH) == 0)
+		{
+			size = static_cast<size_t>(entry.size);
+			return mnoptrData + entry.offset;
+		}
+	}
+
+	return nullptr;
+}
+
+bool AssetPack::Find(const std::string& name, ImageTable& table) const
+{
+	size_t size = 0;
+	const uint8_t* data = Find(name, ASSET_PACK_IMAGE, size);
+
+	if(data == nullptr || size < sizeof(PackedImage))
+	{
+		return false;
+	}
+
+	const PackedImage* packedImage = reinterpret_cast<const PackedImage*>(data);
+	const PackedColor* colors = reinterpret_cast<const PackedColor*>(data + sizeof(PackedImage));
+	size_t numPixels = static_cast<size_t>(packedImage->width) * packedImage->height;
+
+	size_t expectedSize = packedImage->paletteSize > 0 ?
+		sizeof(PackedImage) + packedImage->paletteSize * sizeof(PackedColor) + numPixels :
+		sizeof(PackedImage) + numPixels * sizeof(PackedColor);
+
+	if(size < expectedSize)
+	{
+		return false;
+	}
+
+	table.image = *packedImage;
+
+	if(packedImage->paletteSize > 0)
+	{
+		table.palette = colors;
+		table.indices = reinterpret_cast<const uint8_t*>(colors + packedImage->paletteSize);
+		table.pixels = nullptr;
+	}
+	else
+	{
+		table.palette = nullptr;
+		table.indices = nullptr;
+		table.pixels = colors;
+	}
+
+	return true;
+}
+
+bool AssetPack::Find(const std::string& name, SpriteSectionsTable& table) const
+{
+	size_t size = 0;
+	const uint8_t* data = Find(name, ASSET_PACK_SPRITE_SECTIONS, size);
+
+	if(data == nullptr || size % sizeof(PackedSpriteSection) != 0)
+	{
+		return false;
+	}
+
+	table.sections = reinterpret_cast<const PackedSpriteSection*>(data);
+	table.numSections = static_cast<uint32_t>(size / sizeof(PackedSpriteSection));
+
+	return true;
+}
+
+bool AssetPack::Find(const std::string& name, AnimationsTable& table) const
+{
+	size_t size = 0;
+	const uint8_t* data = Find(name, ASSET_PACK_ANIMATIONS, size);
+
+	if(data == nullptr || size < sizeof(PackedAnimationsHeader))
+	{
+		return false;
+	}
+
+	const PackedAnimationsHeader* header = reinterpret_cast<const PackedAnimationsHeader*>(data);
+
+	size_t expectedSize = sizeof(PackedAnimationsHeader) +
+		header->numAnimations * sizeof(PackedAnimation) +
+		header->numFrameKeys * sizeof(PackedName) +
+		header->numColors * sizeof(PackedColor) +
+		header->numOffsets * sizeof(PackedVec2D);
+
+	if(size < expectedSize)
+	{
+		return false;
+	}
+
+	table.header = *header;
+	table.animations = reinterpret_cast<const PackedAnimation*>(header + 1);
+	table.frameKeys = reinterpret_cast<const PackedName*>(table.animations + header->numAnimations);
+	table.colors = reinterpret_cast<const PackedColor*>(table.frameKeys + header->numFrameKeys);
+	table.offsets = reinterpret_cast<const PackedVec2D*>(table.colors + header->numColors);
+
+	return true;
+}
+
+bool AssetPack::Find(const std::string& name, PacmanLevelTable& table) const
+{
+	size_t size = 0;
+	const uint8_t* data = Find(name, ASSET_PACK_PACMAN_LEVEL, size);
+
+	if(data == nullptr || size < sizeof(PackedPacmanLevelHeader))
+	{
+		return false;
+	}
+
+	const PackedPacmanLevelHeader* header = reinterpret_cast<const PackedPacmanLevelHeader*>(data);
+
+	size_t expectedSize = sizeof(PackedPacmanLevelHeader) +
+		header->numTiles * sizeof(PackedPacmanTile) +
+		header->numBonusItems * sizeof(PackedBonusItem) +
+		static_cast<size_t>(header->numLayoutRows) * header->layoutRowLength;
+
+	if(size < expectedSize)
+	{
+		return false;
+	}
+
+	table.header = *header;
+	table.tiles = reinterpret_cast<const PackedPacmanTile*>(header + 1);
+	table.bonusItems = reinterpret_cast<const PackedBonusItem*>(table.tiles + header->numTiles);
+	table.layout = reinterpret_cast<const char*>(table.bonusItems + header->numBonusItems);
+
+	return true;
+}
+
+bool AssetPack::Find(const std::string& name, BreakoutLevelsTable& table) const
+{
+	size_t size = 0;
+	const uint8_t* data = Find(name, ASSET_PACK_BREAKOUT_LEVELS, size);
+
+	if(data == nullptr || size < sizeof(PackedBreakoutLevelsHeader))
+	{
+		return false;
+	}
+
+	const PackedBreakoutLevelsHeader* header = reinterpret_cast<const PackedBreakoutLevelsHeader*>(data);
+
+	size_t expectedSize = sizeof(PackedBreakoutLevelsHeader) +
+		header->numLevels * sizeof(PackedBreakoutLevel) +
+		header->numBlockTypes * sizeof(PackedBreakoutBlockType) +
+		static_cast<size_t>(header->numRows) * header->rowLength;
+
+	if(size < expectedSize)
+	{
+		return false;
+	}
+
+	table.header = *header;
+	table.levels = reinterpret_cast<const PackedBreakoutLevel*>(header + 1);
+	table.blockTypes = reinterpret_cast<const PackedBreakoutBlockType*>(table.levels + header->numLevels);
+	table.rows = reinterpret_cast<const char*>(table.blockTypes + header->numBlockTypes);
+
+	return true;
+}
+
+std::string AssetPack::AssetName(const std::string& path)
+{
+	size_t slashPos = path.find_last_of("/\\");
+
+	if(slashPos == std::string::npos)
+	{
+		return path;
+	}
+
+	return path.substr(slashPos + 1);
+}
+
+bool AssetPack::Validate() const
+{
+	if(mSize < sizeof(AssetPackHeader))
+	{
+		return false;
+	}
+
+	const AssetPackHeader* header = reinterpret_cast<const AssetPackHeader*>(mnoptrData);
+
+	if(memcmp(header->magic, ASSET_PACK_MAGIC, sizeof(ASSET_PACK_MAGIC)) != 0 || header->version != ASSET_PACK_VERSION)
+	{
+		return false;
+	}
+
+	if(header->entriesOffset % alignof(AssetPackEntry) != 0 ||
+	   static_cast<uint64_t>(header->entriesOffset) + static_cast<uint64_t>(header->numEntries) * sizeof(AssetPackEntry) > mSize)
+	{
+		return false;
+	}
+
+	const AssetPackEntry* entries = reinterpret_cast<const AssetPackEntry*>(mnoptrData + header->entriesOffset);
+
+	for(uint32_t i = 0; i < header->numEntries; ++i)
+	{
+		if(entries[i].offset % ASSET_PACK_ALIGNMENT != 0 || entries[i].offset > mSize || entries[i].size > mSize - entries[i].offset)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
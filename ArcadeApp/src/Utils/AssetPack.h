@@ -0,0 +1,70 @@
+/*
+ * AssetPack.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ASSETPACK_H_
+#define UTILS_ASSETPACK_H_
+
+#include "AssetPackFormat.h"
+#include "AssetTables.h"
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+//Read only view of an Assets.pack built by Tools/AssetPacker. The file is memory mapped,
+//loaders get pointers straight into it which stay valid until Close().
+class AssetPack
+{
+public:
+	AssetPack();
+	~AssetPack();
+
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	bool Open(const std::string& path);
+	void Close();
+
+	inline bool IsOpen() const {return mnoptrData != nullptr;}
+
+	//Returns the payload of the entry or nullptr if the pack doesn't have it
+	const uint8_t* Find(const std::string& name, AssetPackEntryType type, size_t& size) const;
+
+	//Same as above with the payload checked and split into its arrays, false if it's missing or truncated
+	bool Find(const std::string& name, ImageTable& table) const;
+	bool Find(const std::string& name, SpriteSectionsTable& table) const;
+	bool Find(const std::string& name, AnimationsTable& table) const;
+	bool Find(const std::string& name, PacmanLevelTable& table) const;
+	bool Find(const std::string& name, BreakoutLevelsTable& table) const;
+
+	//Names of the entries whose file in directory isn't what was packed - edited since AssetPacker last ran.
+	//Entries without a file there are left out, the pack is all there is of them. Costs a stat per entry,
+	//files are only read when they're newer than the pack and still the packed size.
+	std::vector<std::string> FindStaleEntries(const std::string& directory) const;
+
+	//"some/dir/PacmanSprites.bmp" -> "PacmanSprites.bmp"
+	static std::string AssetName(const std::string& path);
+
+private:
+
+	bool Validate() const;
+
+	std::string mPath;
+	const uint8_t* mnoptrData;
+	size_t mSize;
+	const AssetPackEntry* mnoptrEntries;
+	uint32_t mNumEntries;
+
+#ifdef _WIN32
+	void* mFileHandle;
+	void* mMappingHandle;
+#else
+	int mFileDescriptor;
+#endif
+};
+
+#endif /* UTILS_ASSETPACK_H_ */
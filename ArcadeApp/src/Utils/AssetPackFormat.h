@@ -0,0 +1,227 @@
+/*
+ * AssetPackFormat.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ASSETPACKFORMAT_H_
+#define UTILS_ASSETPACKFORMAT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//On disk layout of Assets.pack, shared by the game and Tools/AssetPacker.
+//Everything in here is plain data so the game can point straight into the mapped file.
+//
+//	AssetPackHeader
+//	AssetPackEntry[numEntries]
+//	payloads, each one starting on an ASSET_PACK_ALIGNMENT boundary
+//
+//Bump ASSET_PACK_VERSION whenever one of these structs changes - a pack with another
+//version is ignored and the game falls back to the text files.
+
+static const char ASSET_PACK_MAGIC[4] = {'A', 'R', 'C', 'P'};
+static const uint32_t ASSET_PACK_VERSION = 2;
+static const uint32_t ASSET_PACK_ALIGNMENT = 16;
+static const uint32_t ASSET_PACK_NAME_LENGTH = 64;
+static const uint32_t ASSET_PACK_KEY_LENGTH = 32;
+
+enum AssetPackEntryType : uint32_t
+{
+	ASSET_PACK_IMAGE = 0,
+	ASSET_PACK_SPRITE_SECTIONS,
+	ASSET_PACK_ANIMATIONS,
+	ASSET_PACK_PACMAN_LEVEL,
+	ASSET_PACK_BREAKOUT_LEVELS
+};
+
+struct AssetPackHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t numEntries;
+	uint32_t entriesOffset;
+};
+
+//name is the asset's file name, ie. "PacmanSprites.bmp" or "Pacman_level.txt".
+//sourceSize and sourceHash are of that file as it was packed, so the game can tell it has been edited since.
+struct AssetPackEntry
+{
+	char name[ASSET_PACK_NAME_LENGTH];
+	uint32_t type;
+	uint32_t reserved;
+	uint64_t offset;
+	uint64_t size;
+	uint64_t sourceSize;
+	uint64_t sourceHash;
+};
+
+//FNV-1a, what sourceHash is
+inline uint64_t AssetPackHash(const uint8_t* data, size_t size)
+{
+	uint64_t hash = 14695981039346656037ull;
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		hash = (hash ^ data[i]) * 1099511628211ull;
+	}
+
+	return hash;
+}
+
+struct PackedColor
+{
+	uint8_t r;
+	uint8_t g;
+	uint8_t b;
+	uint8_t a;
+};
+
+struct PackedVec2D
+{
+	float x;
+	float y;
+};
+
+struct PackedName
+{
+	char name[ASSET_PACK_KEY_LENGTH];
+};
+
+//ASSET_PACK_IMAGE - top down rows.
+//paletteSize > 0: PackedColor[paletteSize] followed by width * height uint8_t indices
+//paletteSize == 0: PackedColor[width * height]
+struct PackedImage
+{
+	uint32_t width;
+	uint32_t height;
+	uint32_t paletteSize;
+	uint32_t reserved;
+};
+
+//ASSET_PACK_SPRITE_SECTIONS - an array of these, one per :sprite
+struct PackedSpriteSection
+{
+	char key[ASSET_PACK_KEY_LENGTH];
+	uint32_t xPos;
+	uint32_t yPos;
+	uint32_t width;
+	uint32_t height;
+	uint32_t trimX;
+	uint32_t trimY;
+	uint32_t trimWidth;
+	uint32_t trimHeight;
+};
+
+//ASSET_PACK_ANIMATIONS
+//	PackedAnimationsHeader
+//	PackedAnimation[numAnimations]
+//	PackedName[numFrameKeys]
+//	PackedColor[numColors] - frame colors and overlay colors of every animation
+//	PackedVec2D[numOffsets]
+struct PackedAnimationsHeader
+{
+	uint32_t numAnimations;
+	uint32_t numFrameKeys;
+	uint32_t numColors;
+	uint32_t numOffsets;
+};
+
+struct PackedAnimation
+{
+	char name[ASSET_PACK_KEY_LENGTH];
+	char spriteSheet[ASSET_PACK_KEY_LENGTH];
+	char overlay[ASSET_PACK_KEY_LENGTH];
+	PackedVec2D size;
+	int32_t fps;
+	uint32_t firstFrameKey;
+	uint32_t numFrameKeys;
+	uint32_t firstFrameColor;
+	uint32_t numFrameColors;
+	uint32_t firstOverlayColor;
+	uint32_t numOverlayColors;
+	uint32_t firstFrameOffset;
+	uint32_t numFrameOffsets;
+};
+
+//ASSET_PACK_PACMAN_LEVEL
+//	PackedPacmanLevelHeader
+//	PackedPacmanTile[numTiles]
+//	PackedBonusItem[numBonusItems]
+//	char[numLayoutRows * layoutRowLength] - rows shorter than layoutRowLength are padded with '\0'
+struct PackedPacmanLevelHeader
+{
+	char bgImage[ASSET_PACK_NAME_LENGTH];
+	PackedVec2D layoutOffset;
+	uint32_t tileHeight;
+	uint32_t numTiles;
+	uint32_t numBonusItems;
+	uint32_t numLayoutRows;
+	uint32_t layoutRowLength;
+	uint32_t reserved;
+};
+
+struct PackedPacmanTile
+{
+	PackedVec2D offset;
+	int32_t width;
+	int32_t collidable;
+	int32_t isTeleportTile;
+	int32_t excludePelletTile;
+	int32_t pacmanSpawnPoint;
+	int32_t itemSpawnPoint;
+	int32_t blinkySpawnPoint;
+	int32_t inkySpawnPoint;
+	int32_t pinkySpawnPoint;
+	int32_t clydeSpawnPoint;
+	int32_t isGate;
+	char teleportToSymbol;
+	char symbol;
+	char reserved[2];
+};
+
+struct PackedBonusItem
+{
+	char spriteName[ASSET_PACK_KEY_LENGTH];
+	uint32_t score;
+	uint32_t begin;
+	uint32_t end;
+	uint32_t reserved;
+};
+
+//ASSET_PACK_BREAKOUT_LEVELS
+//	PackedBreakoutLevelsHeader
+//	PackedBreakoutLevel[numLevels]
+//	PackedBreakoutBlockType[numBlockTypes]
+//	char[numRows * rowLength] - padded with '-'
+struct PackedBreakoutLevelsHeader
+{
+	uint32_t numLevels;
+	uint32_t numBlockTypes;
+	uint32_t numRows;
+	uint32_t rowLength;
+};
+
+struct PackedBreakoutLevel
+{
+	uint32_t firstBlockType;
+	uint32_t numBlockTypes;
+	uint32_t firstRow;
+	uint32_t numRows;
+};
+
+struct PackedBreakoutBlockType
+{
+	PackedColor color;
+	int32_t hp;
+	char symbol;
+	char reserved[3];
+};
+
+static_assert(sizeof(AssetPackHeader) == 16, "AssetPackHeader layout changed");
+static_assert(sizeof(AssetPackEntry) == 104, "AssetPackEntry layout changed");
+static_assert(sizeof(PackedSpriteSection) == 64, "PackedSpriteSection layout changed");
+static_assert(sizeof(PackedPacmanTile) == 56, "PackedPacmanTile layout changed");
+
+#endif /* UTILS_ASSETPACKFORMAT_H_ */
@@ -0,0 +1,94 @@
+/*
+ * AssetTables.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AssetTables.h"
+#include "AssetPack.h"
+#include "App.h"
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+
+namespace
+{
+#ifdef ARCADE_EMBEDDED_ASSETS
+	const EmbeddedAssetTables& EmbeddedTables()
+	{
+		return EMBEDDED_ASSET_TABLES;
+	}
+#else
+	const EmbeddedAssetTables& EmbeddedTables()
+	{
+		static const EmbeddedAssetTables noTables = {};
+		return noTables;
+	}
+#endif
+
+	std::mutex ignoredTablesMutex;
+	std::unordered_set<std::string> ignoredTables;
+
+	std::string Stem(const std::string& name)
+	{
+		return name.substr(0, name.find_last_of('.'));
+	}
+
+	bool IsIgnored(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(ignoredTablesMutex);
+		return !ignoredTables.empty() && ignoredTables.count(Stem(name)) > 0;
+	}
+
+	template<class Table>
+	bool FindEmbeddedTable(const NamedAssetTable<Table>* tables, uint32_t numTables, const std::string& name, Table& table)
+	{
+		for(uint32_t i = 0; i < numTables; ++i)
+		{
+			if(strcmp(tables[i].name, name.c_str()) == 0)
+			{
+				table = tables[i].table;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+bool FindAssetTable(const std::string& name, ImageTable& table)
+{
+	const EmbeddedAssetTables& embedded = EmbeddedTables();
+	return !IsIgnored(name) && (FindEmbeddedTable(embedded.images, embedded.numImages, name, table) || App::Singleton().GetAssetPack().Find(name, table));
+}
+
+bool FindAssetTable(const std::string& name, SpriteSectionsTable& table)
+{
+	const EmbeddedAssetTables& embedded = EmbeddedTables();
+	return !IsIgnored(name) && (FindEmbeddedTable(embedded.spriteSections, embedded.numSpriteSections, name, table) || App::Singleton().GetAssetPack().Find(name, table));
+}
+
+bool FindAssetTable(const std::string& name, AnimationsTable& table)
+{
+	const EmbeddedAssetTables& embedded = EmbeddedTables();
+	return !IsIgnored(name) && (FindEmbeddedTable(embedded.animations, embedded.numAnimations, name, table) || App::Singleton().GetAssetPack().Find(name, table));
+}
+
+bool FindAssetTable(const std::string& name, PacmanLevelTable& table)
+{
+	const EmbeddedAssetTables& embedded = EmbeddedTables();
+	return !IsIgnored(name) && (FindEmbeddedTable(embedded.pacmanLevels, embedded.numPacmanLevels, name, table) || App::Singleton().GetAssetPack().Find(name, table));
+}
+
+bool FindAssetTable(const std::string& name, BreakoutLevelsTable& table)
+{
+	const EmbeddedAssetTables& embedded = EmbeddedTables();
+	return !IsIgnored(name) && (FindEmbeddedTable(embedded.breakoutLevels, embedded.numBreakoutLevels, name, table) || App::Singleton().GetAssetPack().Find(name, table));
+}
+
+void IgnoreAssetTable(const std::string& fileName)
+{
+	std::lock_guard<std::mutex> lock(ignoredTablesMutex);
+	ignoredTables.insert(Stem(fileName));
+}
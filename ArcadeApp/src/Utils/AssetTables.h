@@ -0,0 +1,96 @@
+/*
+ * AssetTables.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ASSETTABLES_H_
+#define UTILS_ASSETTABLES_H_
+
+#include "AssetPackFormat.h"
+#include <string>
+#include <stdint.h>
+
+//Typed views of the pre-converted assets. They point either into the mapped Assets.pack or, in
+//builds with ARCADE_EMBEDDED_ASSETS, into the constexpr tables "AssetPacker --embed" generates.
+//SpriteSheet, BMPImage, Animation, PacmanLevel and BreakoutGameLevel load from these without parsing anything.
+
+struct ImageTable
+{
+	PackedImage image;
+	const PackedColor* palette; //image.paletteSize entries, nullptr when the image isn't indexed
+	const uint8_t* indices;     //width * height, nullptr when the image isn't indexed
+	const PackedColor* pixels;  //width * height, nullptr when the image is indexed
+};
+
+struct SpriteSectionsTable
+{
+	const PackedSpriteSection* sections;
+	uint32_t numSections;
+};
+
+struct AnimationsTable
+{
+	PackedAnimationsHeader header;
+	const PackedAnimation* animations;
+	const PackedName* frameKeys;
+	const PackedColor* colors;
+	const PackedVec2D* offsets;
+};
+
+struct PacmanLevelTable
+{
+	PackedPacmanLevelHeader header;
+	const PackedPacmanTile* tiles;
+	const PackedBonusItem* bonusItems;
+	const char* layout; //numLayoutRows * layoutRowLength
+};
+
+struct BreakoutLevelsTable
+{
+	PackedBreakoutLevelsHeader header;
+	const PackedBreakoutLevel* levels;
+	const PackedBreakoutBlockType* blockTypes;
+	const char* rows; //numRows * rowLength
+};
+
+//name is the asset's file name, same as in the pack
+template<class Table>
+struct NamedAssetTable
+{
+	const char* name;
+	Table table;
+};
+
+struct EmbeddedAssetTables
+{
+	const NamedAssetTable<ImageTable>* images;
+	uint32_t numImages;
+	const NamedAssetTable<SpriteSectionsTable>* spriteSections;
+	uint32_t numSpriteSections;
+	const NamedAssetTable<AnimationsTable>* animations;
+	uint32_t numAnimations;
+	const NamedAssetTable<PacmanLevelTable>* pacmanLevels;
+	uint32_t numPacmanLevels;
+	const NamedAssetTable<BreakoutLevelsTable>* breakoutLevels;
+	uint32_t numBreakoutLevels;
+};
+
+#ifdef ARCADE_EMBEDDED_ASSETS
+//Defined in the generated EmbeddedAssetTables.cpp
+extern const EmbeddedAssetTables EMBEDDED_ASSET_TABLES;
+#endif
+
+//Looks in the embedded tables first, then in the asset pack. False means the asset has to be loaded from its file.
+bool FindAssetTable(const std::string& name, ImageTable& table);
+bool FindAssetTable(const std::string& name, SpriteSectionsTable& table);
+bool FindAssetTable(const std::string& name, AnimationsTable& table);
+bool FindAssetTable(const std::string& name, PacmanLevelTable& table);
+bool FindAssetTable(const std::string& name, BreakoutLevelsTable& table);
+
+//From now on FindAssetTable() says no for every asset named like fileName, whatever its extension, so they're
+//read from their files - for hot reloading files newer than the pack. "PacmanSprites.aimg" covers "PacmanSprites.bmp".
+void IgnoreAssetTable(const std::string& fileName);
+
+#endif /* UTILS_ASSETTABLES_H_ */
@@ -0,0 +1,147 @@
+/*
+ * AssetWatcher.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AssetWatcher.h"
+#include <algorithm>
+#include <iostream>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+AssetWatcher::AssetWatcher(): mInotifyDescriptor(-1), mWatchDescriptor(-1)
+{
+}
+
+AssetWatcher::~AssetWatcher()
+{
+	Stop();
+}
+
+#ifdef __linux__
+
+bool AssetWatcher::Start(const std::string& directory)
+{
+	Stop();
+
+	mInotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+	if(mInotifyDescriptor < 0)
+	{
+		std::cout << "Could not start watching " << directory << " for changes" << std::endl;
+		return false;
+	}
+
+	//Editors either write the file in place or write a temporary and rename it over the old one
+	mWatchDescriptor = inotify_add_watch(mInotifyDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+
+	if(mWatchDescriptor < 0)
+	{
+		std::cout << "Could not watch " << directory << " for changes" << std::endl;
+		Stop();
+		return false;
+	}
+
+	mDirectory = directory;
+
+	return true;
+}
+
+void AssetWatcher::Stop()
+{
+	if(mInotifyDescriptor >= 0)
+	{
+		close(mInotifyDescriptor);
+	}
+
+	mInotifyDescriptor = -1;
+	mWatchDescriptor = -1;
+}
+
+std::vector<AssetChange> AssetWatcher::Poll()
+{
+	std::vector<AssetChange> changes;
+
+	if(mInotifyDescriptor < 0)
+	{
+		return changes;
+	}
+
+	alignas(inotify_event) char buffer[4096];
+
+	for(;;)
+	{
+		ssize_t bytesRead = read(mInotifyDescriptor, buffer, sizeof(buffer));
+
+		if(bytesRead <= 0)
+		{
+			//EAGAIN - nothing more to read right now
+			break;
+		}
+
+		const std::chrono::system_clock::time_point detectedTime = std::chrono::system_clock::now();
+
+		for(ssize_t offset = 0; offset < bytesRead;)
+		{
+			const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+			offset += sizeof(inotify_event) + event->len;
+
+			if(event->len == 0 || (event->mask & IN_ISDIR))
+			{
+				continue;
+			}
+
+			std::string fileName = event->name;
+
+			auto isSameFile = [&fileName](const AssetChange& change){return change.fileName == fileName;};
+
+			if(std::find_if(changes.begin(), changes.end(), isSameFile) != changes.end())
+			{
+				continue;
+			}
+
+			AssetChange change;
+			change.fileName = fileName;
+			change.detectedTime = detectedTime;
+			change.savedTime = detectedTime;
+
+			struct stat fileStat;
+
+			if(stat((mDirectory + fileName).c_str(), &fileStat) == 0)
+			{
+				change.savedTime = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+					std::chrono::seconds(fileStat.st_mtim.tv_sec) + std::chrono::nanoseconds(fileStat.st_mtim.tv_nsec)));
+			}
+
+			changes.push_back(std::move(change));
+		}
+	}
+
+	return changes;
+}
+
+#else
+
+//Nothing to watch with - the caller knows from the false, there's no point saying so on every launch
+bool AssetWatcher::Start(const std::string& directory)
+{
+	return false;
+}
+
+void AssetWatcher::Stop()
+{
+}
+
+std::vector<AssetChange> AssetWatcher::Poll()
+{
+	return std::vector<AssetChange>();
+}
+
+#endif
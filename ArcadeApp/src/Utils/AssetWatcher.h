@@ -0,0 +1,47 @@
+/*
+ * AssetWatcher.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ASSETWATCHER_H_
+#define UTILS_ASSETWATCHER_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+struct AssetChange
+{
+	std::string fileName; //"PacmanSprites.bmp"
+	std::chrono::system_clock::time_point savedTime; //the file's modification time
+	std::chrono::system_clock::time_point detectedTime;
+};
+
+//Watches the assets directory so changed files can be hot reloaded. Uses inotify, so it only
+//does anything on Linux - everywhere else Start() returns false and Poll() never reports a change.
+class AssetWatcher
+{
+public:
+	AssetWatcher();
+	~AssetWatcher();
+
+	AssetWatcher(const AssetWatcher&) = delete;
+	AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+	bool Start(const std::string& directory);
+	void Stop();
+
+	inline bool IsWatching() const {return mInotifyDescriptor >= 0;}
+
+	//Never blocks. Every file written since the last call, once each, even if it was saved several times.
+	std::vector<AssetChange> Poll();
+
+private:
+	std::string mDirectory;
+	int mInotifyDescriptor;
+	int mWatchDescriptor;
+};
+
+#endif /* UTILS_ASSETWATCHER_H_ */
@@ -0,0 +1,363 @@
+/*
+ * AtlasPacking.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "AtlasPacking.h"
+#include "FileCommandLoader.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	//Transparent gap between packed sprites so filtering never picks up a neighbour
+	const uint32_t PADDING = 1;
+
+	struct PackedSprite
+	{
+		std::string key = "";
+
+		//Rect in the source sheet
+		uint32_t xPos = 0;
+		uint32_t yPos = 0;
+		uint32_t width = 0;
+		uint32_t height = 0;
+
+		//Opaque bounds relative to the logical width x height rect
+		uint32_t trimX = 0;
+		uint32_t trimY = 0;
+		uint32_t trimWidth = 0;
+		uint32_t trimHeight = 0;
+
+		//Where the trimmed pixels end up in the packed sheet
+		uint32_t packedX = 0;
+		uint32_t packedY = 0;
+	};
+
+	bool LoadSpriteSections(const std::string& path, std::vector<PackedSprite>& sprites)
+	{
+		FileCommandLoader fileLoader;
+
+		Command spriteCommand;
+		spriteCommand.command = "sprite";
+		spriteCommand.parseFunc = [&](ParseFuncParams params)
+			{
+				sprites.push_back(PackedSprite());
+			};
+		fileLoader.AddCommand(spriteCommand);
+
+		Command keyCommand;
+		keyCommand.command = "key";
+		keyCommand.parseFunc = [&](ParseFuncParams params)
+			{
+				sprites.back().key = FileCommandLoader::ReadString(params);
+			};
+		fileLoader.AddCommand(keyCommand);
+
+		Command xPosCommand;
+		xPosCommand.command = "xPos";
+		xPosCommand.parseFunc = [&](ParseFuncParams params)
+			{
+				sprites.back().xPos = FileCommandLoader::ReadInt(params);
+			};
+		fileLoader.AddCommand(xPosCommand);
+
+		Command yPosCommand;
+		yPosCommand.command = "yPos";
+		yPosCommand.parseFunc = [&](ParseFuncParams params)
+			{
+				sprites.back().yPos = FileCommandLoader::ReadInt(params);
+			};
+		fileLoader.AddCommand(yPosCommand);
+
+		Command widthCommand;
+		widthCommand.command = "width";
+		widthCommand.parseFunc = [&](ParseFuncParams params)
+			{
+				sprites.back().width = FileCommandLoader::ReadInt(params);
+			};
+		fileLoader.AddCommand(widthCommand);
+
+		Command heightCommand;
+		heightCommand.command = "height";
+		heightCommand.parseFunc = [&](ParseFuncParams params)
+			{
+				sprites.back().height = FileCommandLoader::ReadInt(params);
+			};
+		fileLoader.AddCommand(heightCommand);
+
+		return fileLoader.LoadFile(path);
+	}
+
+	uint32_t GetPixel(const SDL_Surface* surface, uint32_t x, uint32_t y)
+	{
+		const uint8_t* row = static_cast<const uint8_t*>(surface->pixels) + y * surface->pitch;
+		return reinterpret_cast<const uint32_t*>(row)[x];
+	}
+
+	void TrimSprite(const SDL_Surface* sheet, PackedSprite& sprite)
+	{
+		uint32_t minX = sprite.width;
+		uint32_t minY = sprite.height;
+		uint32_t maxX = 0;
+		uint32_t maxY = 0;
+
+		for(uint32_t y = 0; y < sprite.height; ++y)
+		{
+			for(uint32_t x = 0; x < sprite.width; ++x)
+			{
+				uint32_t sheetX = sprite.xPos + x;
+				uint32_t sheetY = sprite.yPos + y;
+
+				if(sheetX >= static_cast<uint32_t>(sheet->w) || sheetY >= static_cast<uint32_t>(sheet->h))
+				{
+					continue;
+				}
+
+				uint8_t r, g, b, a;
+				SDL_GetRGBA(GetPixel(sheet, sheetX, sheetY), sheet->format, &r, &g, &b, &a);
+
+				if(a > 0)
+				{
+					minX = std::min(minX, x);
+					minY = std::min(minY, y);
+					maxX = std::max(maxX, x);
+					maxY = std::max(maxY, y);
+				}
+			}
+		}
+
+		if(minX > maxX || minY > maxY)
+		{
+			//Fully transparent sprite - keep a single texel so it still has a valid rect
+			sprite.trimX = 0;
+			sprite.trimY = 0;
+			sprite.trimWidth = 1;
+			sprite.trimHeight = 1;
+			return;
+		}
+
+		sprite.trimX = minX;
+		sprite.trimY = minY;
+		sprite.trimWidth = maxX - minX + 1;
+		sprite.trimHeight = maxY - minY + 1;
+	}
+
+	//Simple shelf packer - tallest sprites first, rows filled left to right
+	void PackSprites(std::vector<PackedSprite>& sprites, uint32_t& atlasWidth, uint32_t& atlasHeight)
+	{
+		std::vector<PackedSprite*> sorted;
+		uint64_t totalArea = 0;
+		uint32_t widest = 0;
+
+		for(PackedSprite& sprite : sprites)
+		{
+			sorted.push_back(&sprite);
+			totalArea += static_cast<uint64_t>(sprite.trimWidth + PADDING) * (sprite.trimHeight + PADDING);
+			widest = std::max(widest, sprite.trimWidth + PADDING);
+		}
+
+		std::stable_sort(sorted.begin(), sorted.end(), [](const PackedSprite* a, const PackedSprite* b) {
+			return a->trimHeight > b->trimHeight;
+		});
+
+		atlasWidth = 1;
+		uint32_t minWidth = std::max(widest, static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(totalArea)))));
+
+		while(atlasWidth < minWidth)
+		{
+			atlasWidth *= 2;
+		}
+
+		uint32_t x = 0;
+		uint32_t y = 0;
+		uint32_t shelfHeight = 0;
+
+		for(PackedSprite* sprite : sorted)
+		{
+			if(x + sprite->trimWidth + PADDING > atlasWidth)
+			{
+				x = 0;
+				y += shelfHeight;
+				shelfHeight = 0;
+			}
+
+			sprite->packedX = x;
+			sprite->packedY = y;
+
+			x += sprite->trimWidth + PADDING;
+			shelfHeight = std::max(shelfHeight, sprite->trimHeight + PADDING);
+		}
+
+		atlasHeight = y + shelfHeight;
+	}
+
+	bool WriteSpriteSections(const std::string& path, const std::vector<PackedSprite>& sprites)
+	{
+		std::ofstream outFile(path);
+
+		if(!outFile.is_open())
+		{
+			std::cout << "Could not write the file: " << path << std::endl;
+			return false;
+		}
+
+		for(const PackedSprite& sprite : sprites)
+		{
+			outFile << ":sprite" << std::endl;
+			outFile << ":key " << sprite.key << std::endl;
+			outFile << ":xPos " << sprite.packedX << std::endl;
+			outFile << ":yPos " << sprite.packedY << std::endl;
+			outFile << ":width " << sprite.width << std::endl;
+			outFile << ":height " << sprite.height << std::endl;
+			outFile << ":trimX " << sprite.trimX << std::endl;
+			outFile << ":trimY " << sprite.trimY << std::endl;
+			outFile << ":trimWidth " << sprite.trimWidth << std::endl;
+			outFile << ":trimHeight " << sprite.trimHeight << std::endl;
+			outFile << std::endl;
+		}
+
+		return true;
+	}
+
+	//The packed sheet is the source pair as it is - same pixels, untrimmed sections
+	bool KeepSourceSheet(const std::string& basePath, const std::string& packedPath)
+	{
+		std::error_code error;
+
+		std::filesystem::copy_file(basePath + ".bmp", packedPath + ".bmp", std::filesystem::copy_options::overwrite_existing, error);
+
+		if(!error)
+		{
+			std::filesystem::copy_file(basePath + ".txt", packedPath + ".txt", std::filesystem::copy_options::overwrite_existing, error);
+		}
+
+		if(error)
+		{
+			std::cout << "Could not copy " << basePath << " to " << packedPath << " - " << error.message() << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+}
+
+std::string PackedSheetName(const std::string& name)
+{
+	return name + "Packed";
+}
+
+bool PackAtlas(const std::string& assetsDir, const std::string& outputDir, const std::string& name, AtlasPackStats& stats)
+{
+	const std::string basePath = assetsDir + "/" + name;
+
+	SDL_Surface* loadedSurface = SDL_LoadBMP((basePath + ".bmp").c_str());
+
+	if(loadedSurface == nullptr)
+	{
+		std::cout << "Could not load the image: " << basePath << ".bmp - " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	SDL_Surface* sheet = SDL_ConvertSurfaceFormat(loadedSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+	SDL_FreeSurface(loadedSurface);
+
+	if(sheet == nullptr)
+	{
+		std::cout << "Could not convert the image: " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	std::vector<PackedSprite> sprites;
+
+	if(!LoadSpriteSections(basePath + ".txt", sprites))
+	{
+		SDL_FreeSurface(sheet);
+		return false;
+	}
+
+	SDL_LockSurface(sheet);
+
+	for(PackedSprite& sprite : sprites)
+	{
+		TrimSprite(sheet, sprite);
+
+		stats.sourceSpritePixels += static_cast<uint64_t>(sprite.width) * sprite.height;
+		stats.packedSpritePixels += static_cast<uint64_t>(sprite.trimWidth) * sprite.trimHeight;
+	}
+
+	uint32_t atlasWidth = 0;
+	uint32_t atlasHeight = 0;
+
+	PackSprites(sprites, atlasWidth, atlasHeight);
+
+	stats.sourceSheetPixels = static_cast<uint64_t>(sheet->w) * sheet->h;
+	stats.packedSheetPixels = static_cast<uint64_t>(atlasWidth) * atlasHeight;
+
+	//Trimming only pays if the sheet shrinks - padding and the power of two width can make it grow instead
+	if(stats.packedSheetPixels >= stats.sourceSheetPixels)
+	{
+		SDL_UnlockSurface(sheet);
+		SDL_FreeSurface(sheet);
+
+		stats.packedSpritePixels = stats.sourceSpritePixels;
+		stats.packedSheetPixels = stats.sourceSheetPixels;
+		stats.keptSource = true;
+
+		return KeepSourceSheet(basePath, outputDir + "/" + PackedSheetName(name));
+	}
+
+	SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+
+	if(atlas == nullptr)
+	{
+		std::cout << "Could not create the packed image: " << SDL_GetError() << std::endl;
+		SDL_UnlockSurface(sheet);
+		SDL_FreeSurface(sheet);
+		return false;
+	}
+
+	SDL_FillRect(atlas, nullptr, SDL_MapRGBA(atlas->format, 0, 0, 0, 0));
+	SDL_LockSurface(atlas);
+
+	for(const PackedSprite& sprite : sprites)
+	{
+		for(uint32_t y = 0; y < sprite.trimHeight; ++y)
+		{
+			uint8_t* atlasRow = static_cast<uint8_t*>(atlas->pixels) + (sprite.packedY + y) * atlas->pitch;
+
+			for(uint32_t x = 0; x < sprite.trimWidth; ++x)
+			{
+				uint32_t sheetX = sprite.xPos + sprite.trimX + x;
+				uint32_t sheetY = sprite.yPos + sprite.trimY + y;
+
+				if(sheetX < static_cast<uint32_t>(sheet->w) && sheetY < static_cast<uint32_t>(sheet->h))
+				{
+					reinterpret_cast<uint32_t*>(atlasRow)[sprite.packedX + x] = GetPixel(sheet, sheetX, sheetY);
+				}
+			}
+		}
+	}
+
+	SDL_UnlockSurface(atlas);
+	SDL_UnlockSurface(sheet);
+	SDL_FreeSurface(sheet);
+
+	bool saved = SDL_SaveBMP(atlas, (outputDir + "/" + PackedSheetName(name) + ".bmp").c_str()) == 0;
+
+	if(!saved)
+	{
+		std::cout << "Could not save the packed image: " << SDL_GetError() << std::endl;
+	}
+
+	SDL_FreeSurface(atlas);
+
+	return saved && WriteSpriteSections(outputDir + "/" + PackedSheetName(name) + ".txt", sprites);
+}
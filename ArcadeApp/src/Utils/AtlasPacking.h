@@ -0,0 +1,33 @@
+/*
+ * AtlasPacking.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_ATLASPACKING_H_
+#define UTILS_ATLASPACKING_H_
+
+#include <string>
+#include <stdint.h>
+
+//Sprite atlas packing, shared by Tools/AtlasPacker and the game's hot reload. Every sprite of a sheet
+//(<name>.bmp + <name>.txt) is trimmed down to its opaque pixels and the trimmed sprites are packed into
+//a new sheet, written with the trim offsets as <name>Packed.bmp + <name>Packed.txt.
+
+struct AtlasPackStats
+{
+	uint64_t sourceSpritePixels = 0;
+	uint64_t packedSpritePixels = 0;
+	uint64_t sourceSheetPixels = 0;
+	uint64_t packedSheetPixels = 0;
+	bool keptSource = false; //packing didn't make the sheet smaller, the packed sheet is a copy of the source
+};
+
+//"PacmanSprites" -> "PacmanSpritesPacked"
+std::string PackedSheetName(const std::string& name);
+
+//Reads <name>.bmp/.txt from assetsDir, writes the packed sheet to outputDir
+bool PackAtlas(const std::string& assetsDir, const std::string& outputDir, const std::string& name, AtlasPackStats& stats);
+
+#endif /* UTILS_ATLASPACKING_H_ */
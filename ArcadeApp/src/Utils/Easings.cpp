@@ -1,61 +1,44 @@
 #include "Easings.h"
 #include "Utils.h"
 #include <cmath>
+#include <algorithm>
 
-namespace ease
+namespace
 {
-	float EaseLinear(float t)
-	{
-		return t;
-	}
-
-	float EaseInQuad(float t)
-	{
-		return t * t;
-	}
-
-	float EaseOutQuad(float t)
-	{
-		return  1.0f - (1.0f - t) * (1.0f - t);
-	}
-
-	float EaseInOutQuad(float t)
+	struct EasingTable
 	{
-		return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.f, 2.f) / 2.f;
-		
-	}
-
-	float EaseInCubic(float t)
-	{
-		return t * t * t;
-	}
+		float samples[ease::EASING_TABLE_SIZE + 1];
+	};
 
-	float EaseOutCubic(float t)
+	struct EasingTables
 	{
-		return 1.0f - std::pow(1.0f - t, 3.0f);
-	}
-
-	float EaseInOutCubic(float t)
-	{
-		return t < 0.5f ? 4 * t * t * t : 1.0f - static_cast<float>(std::pow(-2.0f * t + 2.0f, 3)) / 2.f;	
-	}
-
-	float EaseInQuart(float t)
-	{
-		return t * t * t * t;
-	}
+		EasingTables()
+		{
+			for(uint32_t easing = ease::EASE_IN_BACK; easing <= ease::EASE_IN_OUT_BOUNCE; ++easing)
+			{
+				EasingTable& table = tables[easing - ease::EASE_IN_BACK];
+				ease::EasingFunc func = ease::GetEasingFunc(static_cast<ease::EasingType>(easing));
+
+				for(uint32_t i = 0; i <= ease::EASING_TABLE_SIZE; ++i)
+				{
+					table.samples[i] = func(static_cast<float>(i) / static_cast<float>(ease::EASING_TABLE_SIZE));
+				}
+			}
+		}
 
-	float EaseOutQuart(float t)
-	{
-		return 1.0f - std::pow(1.0f - t, 4.f);
-	}
+		EasingTable tables[ease::EASE_IN_OUT_BOUNCE - ease::EASE_IN_BACK + 1];
+	};
 
-	float EaseInOutQuart(float t)
+	const EasingTables& GetEasingTables()
 	{
-		return t < 0.5f ? 8.0f * t * t * t * t : 1.0f - static_cast<float>(std::pow(-2.0f * t + 2.0f, 4)) / 2.0f;
-		
+		//Built on first use, thread safe
+		static const EasingTables easingTables;
+		return easingTables;
 	}
+}
 
+namespace ease
+{
 	float EaseInBack(float t)
 	{
 		const float c1 = 1.70158f;
@@ -84,7 +67,7 @@ namespace ease
 	float EaseInElastic(float t)
 	{
 		const float c4 = (2.0f * PI) / 3.0f;
-		return t == 0.0f ? 0.0f : t == 1.0f ? 1.0f : -std::pow(2.f, 10.0f * t - 10.0f) * sinf(t * 10.0f - 10.75f) * c4;
+		return t == 0.0f ? 0.0f : t == 1.0f ? 1.0f : -std::pow(2.f, 10.0f * t - 10.0f) * sinf((t * 10.0f - 10.75f) * c4);
 	}
 
 	float EaseOutElastic(float t)
@@ -107,8 +90,8 @@ namespace ease
 			: t == 1.0f
 			? 1.0f
 			: t < 0.5f
-			? -(static_cast<float>(std::pow(2, 20.0f * t - 10.0f)) * sinf(20.f * t - 11.125f) * c5) / 2.0f
-			: (static_cast<float>(std::pow(2, -20.f * t - 10.0f)) * sinf(20.f * t - 11.125f) * c5) / 2.0f + 1;
+			? -(static_cast<float>(std::pow(2, 20.0f * t - 10.0f)) * sinf((20.f * t - 11.125f) * c5)) / 2.0f
+			: (static_cast<float>(std::pow(2, -20.f * t + 10.0f)) * sinf((20.f * t - 11.125f) * c5)) / 2.0f + 1;
 	}
 
 	float EaseInBounce(float t)
@@ -127,15 +110,18 @@ namespace ease
 		}
 		else if (t < 2.0f / d1)
 		{
-			return n1 * (t -= 1.5f / d1) * t + 0.75f;
+			t -= 1.5f / d1;
+			return n1 * t * t + 0.75f;
 		}
 		else if(t < 2.5f / d1)
 		{
-			return n1 * (t -= 2.25f / d1) * t + 0.9375f;
+			t -= 2.25f / d1;
+			return n1 * t * t + 0.9375f;
 		}
 		else
 		{
-			return n1 * (t -= 2.625f / d1) * t + 0.984375f;
+			t -= 2.625f / d1;
+			return n1 * t * t + 0.984375f;
 		}
 	}
 
@@ -153,4 +139,41 @@ namespace ease
 
 		return t;
 	}
+
+	EasingFunc GetEasingFunc(EasingType easing)
+	{
+		static const EasingFunc easingFuncs[NUM_EASING_TYPES] = {
+			EaseLinear,
+			EaseInQuad, EaseOutQuad, EaseInOutQuad,
+			EaseInCubic, EaseOutCubic, EaseInOutCubic,
+			EaseInQuart, EaseOutQuart, EaseInOutQuart,
+			EaseInBack, EaseOutBack, EaseInOutBack,
+			EaseInElastic, EaseOutElastic, EaseInOutElastic,
+			EaseInBounce, EaseOutBounce, EaseInOutBounce,
+			SmoothStep
+		};
+
+		return easing < NUM_EASING_TYPES ? easingFuncs[easing] : EaseLinear;
+	}
+
+	bool HasEasingTable(EasingType easing)
+	{
+		return easing >= EASE_IN_BACK && easing <= EASE_IN_OUT_BOUNCE;
+	}
+
+	float EvaluateTable(EasingType easing, float t)
+	{
+		if(!HasEasingTable(easing))
+		{
+			return Evaluate(easing, t);
+		}
+
+		const float* samples = GetEasingTables().tables[easing - EASE_IN_BACK].samples;
+
+		float position = std::min(std::max(t, 0.0f), 1.0f) * static_cast<float>(EASING_TABLE_SIZE);
+		uint32_t index = std::min(static_cast<uint32_t>(position), EASING_TABLE_SIZE - 1);
+		float fraction = position - static_cast<float>(index);
+
+		return samples[index] + (samples[index + 1] - samples[index]) * fraction;
+	}
 }
@@ -1,24 +1,89 @@
 #pragma once
 
-#include <functional>
+#include <cmath>
+#include <stdint.h>
 
 namespace ease
 {
-	using EasingFunc = std::function<float(float)>;
+	//Plain function pointer - any of the functions below or a captureless lambda. Hot callers should use
+	//an EasingType with Ease<>() or Evaluate() instead so the call can be inlined.
+	using EasingFunc = float(*)(float);
 
-	float EaseLinear(float t);
+	enum EasingType : uint8_t
+	{
+		EASE_LINEAR = 0,
+		EASE_IN_QUAD,
+		EASE_OUT_QUAD,
+		EASE_IN_OUT_QUAD,
+		EASE_IN_CUBIC,
+		EASE_OUT_CUBIC,
+		EASE_IN_OUT_CUBIC,
+		EASE_IN_QUART,
+		EASE_OUT_QUART,
+		EASE_IN_OUT_QUART,
+		EASE_IN_BACK,
+		EASE_OUT_BACK,
+		EASE_IN_OUT_BACK,
+		EASE_IN_ELASTIC,
+		EASE_OUT_ELASTIC,
+		EASE_IN_OUT_ELASTIC,
+		EASE_IN_BOUNCE,
+		EASE_OUT_BOUNCE,
+		EASE_IN_OUT_BOUNCE,
+		EASE_SMOOTH_STEP,
+		NUM_EASING_TYPES
+	};
 
-	float EaseInQuad(float t);
-	float EaseOutQuad(float t);
-	float EaseInOutQuad(float t);
-	
-	float EaseInCubic(float t);
-	float EaseOutCubic(float t);
-	float EaseInOutCubic(float t);
+	//The polynomial ones are cheap enough to inline
+	inline float EaseLinear(float t)
+	{
+		return t;
+	}
 
-	float EaseInQuart(float t);
-	float EaseOutQuart(float t);
-	float EaseInOutQuart(float t);
+	inline float EaseInQuad(float t)
+	{
+		return t * t;
+	}
+
+	inline float EaseOutQuad(float t)
+	{
+		return  1.0f - (1.0f - t) * (1.0f - t);
+	}
+
+	inline float EaseInOutQuad(float t)
+	{
+		return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.f, 2.f) / 2.f;
+	}
+
+	inline float EaseInCubic(float t)
+	{
+		return t * t * t;
+	}
+
+	inline float EaseOutCubic(float t)
+	{
+		return 1.0f - std::pow(1.0f - t, 3.0f);
+	}
+
+	inline float EaseInOutCubic(float t)
+	{
+		return t < 0.5f ? 4 * t * t * t : 1.0f - static_cast<float>(std::pow(-2.0f * t + 2.0f, 3)) / 2.f;
+	}
+
+	inline float EaseInQuart(float t)
+	{
+		return t * t * t * t;
+	}
+
+	inline float EaseOutQuart(float t)
+	{
+		return 1.0f - std::pow(1.0f - t, 4.f);
+	}
+
+	inline float EaseInOutQuart(float t)
+	{
+		return t < 0.5f ? 8.0f * t * t * t * t : 1.0f - static_cast<float>(std::pow(-2.0f * t + 2.0f, 4)) / 2.0f;
+	}
 
 	float EaseInBack(float t);
 	float EaseOutBack(float t);
@@ -33,4 +98,53 @@ namespace ease
 	float EaseInOutBounce(float t);
 
 	float SmoothStep(float t);
-}
\ No newline at end of file
+
+	EasingFunc GetEasingFunc(EasingType easing);
+
+	//With a constant easing the switch folds away
+	inline float Evaluate(EasingType easing, float t)
+	{
+		switch(easing)
+		{
+			case EASE_LINEAR: return EaseLinear(t);
+			case EASE_IN_QUAD: return EaseInQuad(t);
+			case EASE_OUT_QUAD: return EaseOutQuad(t);
+			case EASE_IN_OUT_QUAD: return EaseInOutQuad(t);
+			case EASE_IN_CUBIC: return EaseInCubic(t);
+			case EASE_OUT_CUBIC: return EaseOutCubic(t);
+			case EASE_IN_OUT_CUBIC: return EaseInOutCubic(t);
+			case EASE_IN_QUART: return EaseInQuart(t);
+			case EASE_OUT_QUART: return EaseOutQuart(t);
+			case EASE_IN_OUT_QUART: return EaseInOutQuart(t);
+			case EASE_IN_BACK: return EaseInBack(t);
+			case EASE_OUT_BACK: return EaseOutBack(t);
+			case EASE_IN_OUT_BACK: return EaseInOutBack(t);
+			case EASE_IN_ELASTIC: return EaseInElastic(t);
+			case EASE_OUT_ELASTIC: return EaseOutElastic(t);
+			case EASE_IN_OUT_ELASTIC: return EaseInOutElastic(t);
+			case EASE_IN_BOUNCE: return EaseInBounce(t);
+			case EASE_OUT_BOUNCE: return EaseOutBounce(t);
+			case EASE_IN_OUT_BOUNCE: return EaseInOutBounce(t);
+			case EASE_SMOOTH_STEP: return SmoothStep(t);
+			default: return t;
+		}
+	}
+
+	//Template tag version, ie. Ease<EASE_OUT_QUAD>(t)
+	template<EasingType easing>
+	inline float Ease(float t)
+	{
+		return Evaluate(easing, t);
+	}
+
+	//Precomputed tables for the expensive easings - EASING_TABLE_SIZE segments over [0, 1] sampled once on first use,
+	//linearly interpolated in between. t is clamped to [0, 1]. The other easings are just evaluated directly.
+	//Largest absolute error against the exact function, measured over a million evenly spaced t:
+	//	back     < 5e-6
+	//	elastic  < 5e-4 (in, out), < 1e-4 (in-out)
+	//	bounce   < 2e-3, right at the kinks between bounces - the interpolation cuts the corner
+	static const uint32_t EASING_TABLE_SIZE = 1024;
+
+	bool HasEasingTable(EasingType easing);
+	float EvaluateTable(EasingType easing, float t);
+}
@@ -7,21 +7,96 @@
 #include "FileCommandLoader.h"
 #include <fstream>
 #include <iostream>
+#include <charconv>
+#include <algorithm>
 #include "Color.h"
 #include "Vec2D.h"
 
+namespace
+{
+	//Skips the spaces in front of the number, parses it and moves str past it
+	int ParseInt(std::string_view& str)
+	{
+		size_t start = str.find_first_not_of(' ');
+
+		if(start == std::string_view::npos)
+		{
+			str = std::string_view();
+			return 0;
+		}
+
+		const char* first = str.data() + start;
+		const char* last = str.data() + str.length();
+
+		if(*first == '+')
+		{
+			++first;
+		}
+
+		int value = 0;
+		std::from_chars_result result = std::from_chars(first, last, value);
+
+		str.remove_prefix(result.ptr - str.data());
+		return value;
+	}
+
+	//Pulls the next line out of text, without the line break
+	bool NextLine(std::string_view& text, std::string_view& line)
+	{
+		if(text.empty())
+		{
+			return false;
+		}
+
+		size_t endPos = text.find('\n');
+
+		if(endPos == std::string_view::npos)
+		{
+			line = text;
+			text = std::string_view();
+		}
+		else
+		{
+			line = text.substr(0, endPos);
+			text.remove_prefix(endPos + 1);
+		}
+
+		if(!line.empty() && line.back() == '\r')
+		{
+			line.remove_suffix(1);
+		}
+
+		return true;
+	}
+
+	std::string_view Arguments(const ParseFuncParams& params)
+	{
+		if(params.dilimitPos + 1 >= params.line.length())
+		{
+			return std::string_view();
+		}
+
+		return params.line.substr(params.dilimitPos + 1);
+	}
+}
+
 void FileCommandLoader::AddCommand(const Command& command)
 {
+	for(Command& existing : mCommands)
+	{
+		if(existing.command == command.command)
+		{
+			existing = command;
+			return;
+		}
+	}
+
 	mCommands.push_back(command);
 }
 
 bool FileCommandLoader::LoadFile(const std::string& filePath)
 {
-	std::ifstream inFile;
-
-	inFile.open(filePath);
-
-	std::string line = "";
+	std::ifstream inFile(filePath, std::ios::binary | std::ios::ate);
 
 	if(!inFile.is_open())
 	{
@@ -29,117 +104,128 @@ bool FileCommandLoader::LoadFile(const std::string& filePath)
 		return false;
 	}
 
-	while(!inFile.eof())
+	//One read for the whole file, every line and token after this is a view into it
+	std::string contents;
+	contents.resize(static_cast<size_t>(inFile.tellg()));
+	inFile.seekg(0);
+	inFile.read(&contents[0], contents.size());
+	inFile.close();
+
+	mCommandIndices.clear();
+	mCommandIndices.reserve(mCommands.size());
+
+	for(size_t i = 0; i < mCommands.size(); ++i)
 	{
-		std::getline(inFile, line);
+		mCommandIndices.emplace(mCommands[i].command, i);
+	}
 
-		size_t commandPos = std::string::npos;
+	std::string_view text = contents;
+	std::string_view line;
+
+	while(NextLine(text, line))
+	{
+		size_t commandPos = line.find(':');
 
-		if((commandPos = line.find(":")) != std::string::npos)
+		if(commandPos == std::string_view::npos)
 		{
-			size_t dilimitPos = line.find_first_of(" ", commandPos);
+			continue;
+		}
 
-			if(dilimitPos == std::string::npos)
-			{
-				dilimitPos = line.length();
-			}
-			else
-			{
-				dilimitPos -= 1;
-			}
+		size_t dilimitPos = line.find(' ', commandPos);
 
-			std::string commandStr = line.substr(commandPos+1, dilimitPos);
-			dilimitPos += 1;
+		if(dilimitPos == std::string_view::npos)
+		{
+			dilimitPos = line.length();
+		}
 
-			for(size_t commandIndex = 0; commandIndex < mCommands.size(); ++commandIndex)
+		const Command* command = FindCommand(line.substr(commandPos + 1, dilimitPos - commandPos - 1));
+
+		if(!command)
+		{
+			continue;
+		}
+
+		ParseFuncParams params;
+		params.dilimitPos = dilimitPos;
+		params.lineNum = 0;
+		params.line = line;
+
+		if(command->commandType == COMMAND_ONE_LINE)
+		{
+			command->parseFunc(params);
+		}
+		else
+		{
+			std::string_view numLines = Arguments(params);
+			int totalLines = ParseInt(numLines);
+			int lineNum = 0;
+
+			while(lineNum < totalLines && NextLine(text, line))
 			{
-				if(commandStr == mCommands[commandIndex].command)
+				if(line.empty())
 				{
-					if(mCommands[commandIndex].commandType == COMMAND_ONE_LINE)
-					{
-						ParseFuncParams params;
-						params.dilimitPos = dilimitPos;
-						params.lineNum = 0;
-						params.line = line;
-						mCommands[commandIndex].parseFunc(params);
-					}
-					else
-					{
-						std::string numLines = line.substr(dilimitPos+1);
-						int totalLines = std::stoi(numLines);
-						int lineNum = 0;
-
-						while(lineNum < totalLines)
-						{
-							std::getline(inFile, line);
-
-
-							if(line.empty())
-							{
-								continue;
-							}
-							else
-							{
-								ParseFuncParams params;
-								params.dilimitPos = 0;
-								params.lineNum = lineNum;
-								params.line = line;
-								mCommands[commandIndex].parseFunc(params);
-								++lineNum;
-							}
-						}
-					}
+					continue;
 				}
-			}
 
+				params.dilimitPos = 0;
+				params.lineNum = lineNum;
+				params.line = line;
+				command->parseFunc(params);
+				++lineNum;
+			}
 		}
 	}
+
 	return true;
 }
 
-Color FileCommandLoader::ReadColor(const ParseFuncParams& params)
+const Command* FileCommandLoader::FindCommand(std::string_view commandStr) const
 {
-	size_t nextSpacePos = params.line.find_first_of(" ", params.dilimitPos+1);
+	auto iter = mCommandIndices.find(commandStr);
 
-	int r = std::stoi(params.line.substr(params.dilimitPos, (nextSpacePos - params.dilimitPos)));
+	if(iter == mCommandIndices.end())
+	{
+		return nullptr;
+	}
 
-	size_t lastSpacePos = nextSpacePos;
-	nextSpacePos = params.line.find_first_of(" ", lastSpacePos + 1);
-	int g = std::stoi(params.line.substr(lastSpacePos+1, nextSpacePos - lastSpacePos));
+	return &mCommands[iter->second];
+}
 
-	lastSpacePos = nextSpacePos;
-	nextSpacePos = params.line.find_first_of(" ", lastSpacePos + 1);
-	int b = std::stoi(params.line.substr(lastSpacePos + 1, nextSpacePos - lastSpacePos));
+Color FileCommandLoader::ReadColor(const ParseFuncParams& params)
+{
+	std::string_view str = params.line.substr(std::min(params.dilimitPos, params.line.length()));
 
-	int a = std::stoi(params.line.substr(nextSpacePos+1));
+	int r = ParseInt(str);
+	int g = ParseInt(str);
+	int b = ParseInt(str);
+	int a = ParseInt(str);
 
 	return Color(r, g, b, a);
 }
 
 Vec2D FileCommandLoader::ReadSize(const ParseFuncParams& params)
 {
-	size_t nextSpacePos = params.line.find_first_of(" ", params.dilimitPos+1);
-	int width = std::stoi(params.line.substr(params.dilimitPos, nextSpacePos - params.dilimitPos));
-	size_t lastSpacePos = nextSpacePos;
-	nextSpacePos = params.line.find_first_of(" ", lastSpacePos + 1);
-	int height = std::stoi(params.line.substr(lastSpacePos+1, nextSpacePos - lastSpacePos));
+	std::string_view str = params.line.substr(std::min(params.dilimitPos, params.line.length()));
+
+	int width = ParseInt(str);
+	int height = ParseInt(str);
 
 	return Vec2D(static_cast<float>(width), static_cast<float>(height));
 }
 
 int FileCommandLoader::ReadInt(const ParseFuncParams& params)
 {
-	std::string intStr = params.line.substr(params.dilimitPos+1);
-	return std::stoi(intStr);
+	std::string_view str = Arguments(params);
+	return ParseInt(str);
 }
 
 std::string FileCommandLoader::ReadString(const ParseFuncParams& params)
 {
-	return params.line.substr(params.dilimitPos+1);
+	return std::string(Arguments(params));
 }
 
 char FileCommandLoader::ReadChar(const ParseFuncParams& params)
 {
- 	return params.line.substr(params.dilimitPos+1)[0];
+	std::string_view str = Arguments(params);
+	return str.empty() ? '\0' : str[0];
 }
-
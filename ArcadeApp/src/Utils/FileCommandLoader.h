@@ -11,6 +11,8 @@
 #include <functional>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <stdint.h>
 class Color;
 class Vec2D;
@@ -21,9 +23,10 @@ enum CommandType
 	COMMAND_MULTI_LINE
 };
 
+//line points into the loader's copy of the file and is only valid for the duration of the parseFunc call
 struct ParseFuncParams
 {
-	std::string line;
+	std::string_view line;
 	size_t dilimitPos;
 	uint32_t lineNum;
 };
@@ -41,6 +44,7 @@ class FileCommandLoader
 {
 public:
 
+	//Registering the same command twice replaces the first one
 	void AddCommand(const Command& command);
 	bool LoadFile(const std::string& filePath);
 
@@ -51,7 +55,11 @@ public:
 	static char ReadChar(const ParseFuncParams& params);
 
 private:
+	const Command* FindCommand(std::string_view commandStr) const;
+
 	std::vector<Command> mCommands;
+	//Views of the names in mCommands, rebuilt by LoadFile once every command is added
+	std::unordered_map<std::string_view, size_t> mCommandIndices;
 };
 
 #endif /* UTILS_FILECOMMANDLOADER_H_ */
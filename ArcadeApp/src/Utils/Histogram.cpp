@@ -0,0 +1,94 @@
+/*
+ * Histogram.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "Histogram.h"
+#include <algorithm>
+#include <cmath>
+
+//Below 2 * SUB_BUCKET_COUNT every value gets its own bucket. Above, a value with its top bit at
+//SUB_BUCKET_BITS + shift keeps its top SUB_BUCKET_BITS + 1 bits, so each power of 2 gets SUB_BUCKET_COUNT buckets.
+
+Histogram::Histogram(uint64_t maxValue): mCount(0), mSum(0), mMin(UINT64_MAX), mMax(0)
+{
+	mCounts.resize(BucketIndex(maxValue) + 1, 0);
+}
+
+void Histogram::Record(uint64_t value)
+{
+	size_t index = std::min(BucketIndex(value), mCounts.size() - 1);
+
+	++mCounts[index];
+	++mCount;
+	mSum += value;
+	mMin = std::min(mMin, value);
+	mMax = std::max(mMax, value);
+}
+
+void Histogram::Reset()
+{
+	std::fill(mCounts.begin(), mCounts.end(), 0);
+	mCount = 0;
+	mSum = 0;
+	mMin = UINT64_MAX;
+	mMax = 0;
+}
+
+uint64_t Histogram::ValueAtPercentile(double percentile) const
+{
+	if(mCount == 0)
+	{
+		return 0;
+	}
+
+	percentile = std::min(std::max(percentile, 0.0), 100.0);
+
+	//Nearest rank - the smallest value with at least percentile% of the samples at or below it
+	uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(mCount))), 1);
+	uint64_t seen = 0;
+
+	for(size_t i = 0; i < mCounts.size(); ++i)
+	{
+		seen += mCounts[i];
+
+		if(seen >= rank)
+		{
+			//Never past what was actually recorded - the top bucket also has everything over maxValue
+			return i + 1 == mCounts.size() ? mMax : std::min(HighestValueInBucket(i), mMax);
+		}
+	}
+
+	return mMax;
+}
+
+size_t Histogram::BucketIndex(uint64_t value) const
+{
+	if(value < 2 * SUB_BUCKET_COUNT)
+	{
+		return static_cast<size_t>(value);
+	}
+
+	uint32_t shift = 1;
+	while((value >> (shift + SUB_BUCKET_BITS + 1)) != 0)
+	{
+		++shift;
+	}
+
+	return static_cast<size_t>(SUB_BUCKET_COUNT * (shift + 1) + ((value >> shift) - SUB_BUCKET_COUNT));
+}
+
+uint64_t Histogram::HighestValueInBucket(size_t index) const
+{
+	if(index < 2 * SUB_BUCKET_COUNT)
+	{
+		return index;
+	}
+
+	uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKET_COUNT) - 1;
+	uint64_t subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+
+	return ((subBucket + 1) << shift) - 1;
+}
@@ -0,0 +1,49 @@
+/*
+ * Histogram.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_HISTOGRAM_H_
+#define UTILS_HISTOGRAM_H_
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+//Log-bucketed histogram (HDR style) - every power of 2 is split into SUB_BUCKET_COUNT linear buckets, so any
+//value comes back within 1 / SUB_BUCKET_COUNT (under 1%) of what was recorded however big it is.
+//Recording is a couple of shifts and an increment, memory is fixed by the largest trackable value.
+class Histogram
+{
+public:
+	static const uint32_t SUB_BUCKET_BITS = 7;
+	static const uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+
+	//Values above maxValue go in the top bucket, Max() still has the real one
+	explicit Histogram(uint64_t maxValue);
+
+	void Record(uint64_t value);
+	void Reset();
+
+	//percentile in [0, 100], the largest value that could have landed in its bucket
+	uint64_t ValueAtPercentile(double percentile) const;
+
+	inline uint64_t Count() const {return mCount;}
+	inline uint64_t Min() const {return mCount > 0 ? mMin : 0;}
+	inline uint64_t Max() const {return mMax;}
+	inline double Mean() const {return mCount > 0 ? static_cast<double>(mSum) / static_cast<double>(mCount) : 0.0;}
+
+private:
+	size_t BucketIndex(uint64_t value) const;
+	uint64_t HighestValueInBucket(size_t index) const;
+
+	std::vector<uint64_t> mCounts;
+	uint64_t mCount;
+	uint64_t mSum;
+	uint64_t mMin;
+	uint64_t mMax;
+};
+
+#endif /* UTILS_HISTOGRAM_H_ */
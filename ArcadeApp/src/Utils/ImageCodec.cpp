@@ -0,0 +1,423 @@
+/*
+ * ImageCodec.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "ImageCodec.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <cstring>
+
+namespace
+{
+	//Same ops as QOI
+	const uint8_t OP_INDEX = 0x00; //00xxxxxx - index into the recently seen colors
+	const uint8_t OP_DIFF = 0x40;  //01rrggbb - small difference to the previous pixel
+	const uint8_t OP_LUMA = 0x80;  //10gggggg rrrrbbbb - green difference, red and blue relative to it
+	const uint8_t OP_RUN = 0xC0;   //11xxxxxx - previous pixel repeated 1 to 62 times
+	const uint8_t OP_RGB = 0xFE;
+	const uint8_t OP_RGBA = 0xFF;
+	const uint8_t OP_MASK = 0xC0;
+
+	const uint32_t MAX_RUN = 62;
+	const uint32_t INDEX_SIZE = 64;
+
+	struct Pixel
+	{
+		uint8_t r = 0;
+		uint8_t g = 0;
+		uint8_t b = 0;
+		uint8_t a = 255;
+
+		inline bool operator==(const Pixel& p) const {return r == p.r && g == p.g && b == p.b && a == p.a;}
+		inline bool operator!=(const Pixel& p) const {return !(*this == p);}
+	};
+
+	inline uint32_t IndexOf(const Pixel& p)
+	{
+		return (p.r * 3 + p.g * 5 + p.b * 7 + p.a * 11) % INDEX_SIZE;
+	}
+
+	//The index starts out all 0, unlike the previous pixel which starts out opaque black
+	void ClearIndex(Pixel (&index)[INDEX_SIZE])
+	{
+		for(Pixel& pixel : index)
+		{
+			pixel.a = 0;
+		}
+	}
+
+	void EncodeChunk(const uint8_t* rgba, size_t numPixels, std::vector<uint8_t>& out)
+	{
+		Pixel index[INDEX_SIZE];
+		ClearIndex(index);
+
+		Pixel previous;
+		uint32_t run = 0;
+
+		for(size_t i = 0; i < numPixels; ++i)
+		{
+			Pixel pixel;
+			memcpy(&pixel, rgba + i * 4, 4);
+
+			if(pixel == previous)
+			{
+				++run;
+
+				if(run == MAX_RUN || i + 1 == numPixels)
+				{
+					out.push_back(static_cast<uint8_t>(OP_RUN | (run - 1)));
+					run = 0;
+				}
+
+				continue;
+			}
+
+			if(run > 0)
+			{
+				out.push_back(static_cast<uint8_t>(OP_RUN | (run - 1)));
+				run = 0;
+			}
+
+			uint32_t indexPos = IndexOf(pixel);
+
+			if(index[indexPos] == pixel)
+			{
+				out.push_back(static_cast<uint8_t>(OP_INDEX | indexPos));
+			}
+			else
+			{
+				index[indexPos] = pixel;
+
+				if(pixel.a == previous.a)
+				{
+					int8_t dr = static_cast<int8_t>(pixel.r - previous.r);
+					int8_t dg = static_cast<int8_t>(pixel.g - previous.g);
+					int8_t db = static_cast<int8_t>(pixel.b - previous.b);
+					int8_t drg = static_cast<int8_t>(dr - dg);
+					int8_t dbg = static_cast<int8_t>(db - dg);
+
+					if(dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1)
+					{
+						out.push_back(static_cast<uint8_t>(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+					}
+					else if(dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7)
+					{
+						out.push_back(static_cast<uint8_t>(OP_LUMA | (dg + 32)));
+						out.push_back(static_cast<uint8_t>(((drg + 8) << 4) | (dbg + 8)));
+					}
+					else
+					{
+						out.push_back(OP_RGB);
+						out.push_back(pixel.r);
+						out.push_back(pixel.g);
+						out.push_back(pixel.b);
+					}
+				}
+				else
+				{
+					out.push_back(OP_RGBA);
+					out.push_back(pixel.r);
+					out.push_back(pixel.g);
+					out.push_back(pixel.b);
+					out.push_back(pixel.a);
+				}
+			}
+
+			previous = pixel;
+		}
+	}
+
+	struct DecodeState
+	{
+		CompressedImageView image;
+		uint32_t numChunks = 0; //a copy, the image's header isn't ours to read once the caller has returned
+		const DecodedChunkFunc* noptrDecodedChunk = nullptr;
+		std::atomic<uint32_t> nextChunk{0};
+		std::atomic<uint32_t> finishedChunks{0};
+		std::atomic<bool> failed{false};
+		std::mutex mutex;
+		std::condition_variable allFinished;
+	};
+
+	//Takes chunks until there are none left. Only a claimed chunk touches the caller's data, and the
+	//caller waits for every claimed chunk, so a job that starts after the fact just returns.
+	void DecodeChunks(DecodeState& state)
+	{
+		const uint32_t numChunks = state.numChunks;
+		std::vector<uint8_t> rgba;
+
+		for(;;)
+		{
+			uint32_t chunk = state.nextChunk++;
+
+			if(chunk >= numChunks)
+			{
+				return;
+			}
+
+			uint32_t numRows = state.image.ChunkNumRows(chunk);
+			rgba.resize(static_cast<size_t>(numRows) * state.image.Width() * 4);
+
+			if(state.image.DecodeChunk(chunk, rgba.data()))
+			{
+				(*state.noptrDecodedChunk)(state.image.ChunkFirstRow(chunk), numRows, rgba.data());
+			}
+			else
+			{
+				state.failed = true;
+			}
+
+			if(++state.finishedChunks == numChunks)
+			{
+				std::lock_guard<std::mutex> lock(state.mutex);
+				state.allFinished.notify_all();
+			}
+		}
+	}
+}
+
+std::vector<uint8_t> EncodeImage(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t rowsPerChunk)
+{
+	if(rowsPerChunk == 0)
+	{
+		rowsPerChunk = COMPRESSED_IMAGE_DEFAULT_ROWS_PER_CHUNK;
+	}
+
+	CompressedImageHeader header;
+	memcpy(header.magic, COMPRESSED_IMAGE_MAGIC, sizeof(header.magic));
+	header.version = COMPRESSED_IMAGE_VERSION;
+	header.width = width;
+	header.height = height;
+	header.rowsPerChunk = rowsPerChunk;
+	header.numChunks = (height + rowsPerChunk - 1) / rowsPerChunk;
+
+	std::vector<CompressedImageChunk> chunks(header.numChunks);
+	std::vector<uint8_t> streams;
+
+	for(uint32_t chunk = 0; chunk < header.numChunks; ++chunk)
+	{
+		uint32_t firstRow = chunk * rowsPerChunk;
+		uint32_t numRows = height - firstRow < rowsPerChunk ? height - firstRow : rowsPerChunk;
+
+		chunks[chunk].offset = static_cast<uint32_t>(sizeof(CompressedImageHeader) + chunks.size() * sizeof(CompressedImageChunk) + streams.size());
+
+		EncodeChunk(rgba + static_cast<size_t>(firstRow) * width * 4, static_cast<size_t>(numRows) * width, streams);
+
+		chunks[chunk].size = static_cast<uint32_t>(sizeof(CompressedImageHeader) + chunks.size() * sizeof(CompressedImageChunk) + streams.size()) - chunks[chunk].offset;
+	}
+
+	std::vector<uint8_t> encoded(sizeof(CompressedImageHeader) + chunks.size() * sizeof(CompressedImageChunk));
+	memcpy(encoded.data(), &header, sizeof(header));
+
+	if(!chunks.empty())
+	{
+		memcpy(encoded.data() + sizeof(header), chunks.data(), chunks.size() * sizeof(CompressedImageChunk));
+	}
+
+	encoded.insert(encoded.end(), streams.begin(), streams.end());
+
+	return encoded;
+}
+
+CompressedImageView::CompressedImageView(): mnoptrData(nullptr), mSize(0), mnoptrHeader(nullptr), mnoptrChunks(nullptr)
+{
+
+}
+
+bool CompressedImageView::Open(const uint8_t* data, size_t size)
+{
+	mnoptrData = nullptr;
+	mSize = 0;
+	mnoptrHeader = nullptr;
+	mnoptrChunks = nullptr;
+
+	if(data == nullptr || size < sizeof(CompressedImageHeader))
+	{
+		return false;
+	}
+
+	const CompressedImageHeader* header = reinterpret_cast<const CompressedImageHeader*>(data);
+
+	if(memcmp(header->magic, COMPRESSED_IMAGE_MAGIC, sizeof(COMPRESSED_IMAGE_MAGIC)) != 0 || header->version != COMPRESSED_IMAGE_VERSION ||
+	   header->width == 0 || header->height == 0 || header->rowsPerChunk == 0 ||
+	   header->numChunks != (header->height + header->rowsPerChunk - 1) / header->rowsPerChunk ||
+	   sizeof(CompressedImageHeader) + static_cast<uint64_t>(header->numChunks) * sizeof(CompressedImageChunk) > size)
+	{
+		return false;
+	}
+
+	const CompressedImageChunk* chunks = reinterpret_cast<const CompressedImageChunk*>(data + sizeof(CompressedImageHeader));
+
+	for(uint32_t i = 0; i < header->numChunks; ++i)
+	{
+		if(chunks[i].offset > size || chunks[i].size > size - chunks[i].offset)
+		{
+			return false;
+		}
+	}
+
+	mnoptrData = data;
+	mSize = size;
+	mnoptrHeader = header;
+	mnoptrChunks = chunks;
+
+	return true;
+}
+
+uint32_t CompressedImageView::ChunkFirstRow(uint32_t chunk) const
+{
+	return chunk * mnoptrHeader->rowsPerChunk;
+}
+
+uint32_t CompressedImageView::ChunkNumRows(uint32_t chunk) const
+{
+	uint32_t firstRow = ChunkFirstRow(chunk);
+	uint32_t rowsLeft = mnoptrHeader->height - firstRow;
+
+	return rowsLeft < mnoptrHeader->rowsPerChunk ? rowsLeft : mnoptrHeader->rowsPerChunk;
+}
+
+bool CompressedImageView::DecodeChunk(uint32_t chunk, uint8_t* rgba) const
+{
+	if(chunk >= NumChunks())
+	{
+		return false;
+	}
+
+	const uint8_t* in = mnoptrData + mnoptrChunks[chunk].offset;
+	const uint8_t* end = in + mnoptrChunks[chunk].size;
+
+	const size_t numPixels = static_cast<size_t>(ChunkNumRows(chunk)) * Width();
+	uint8_t* out = rgba;
+	uint8_t* outEnd = rgba + numPixels * 4;
+
+	Pixel index[INDEX_SIZE];
+	ClearIndex(index);
+
+	Pixel pixel;
+
+	while(out < outEnd)
+	{
+		if(in >= end)
+		{
+			return false;
+		}
+
+		uint8_t op = *in++;
+		uint32_t run = 1;
+
+		if(op == OP_RGB)
+		{
+			if(end - in < 3)
+			{
+				return false;
+			}
+
+			pixel.r = in[0];
+			pixel.g = in[1];
+			pixel.b = in[2];
+			in += 3;
+		}
+		else if(op == OP_RGBA)
+		{
+			if(end - in < 4)
+			{
+				return false;
+			}
+
+			pixel.r = in[0];
+			pixel.g = in[1];
+			pixel.b = in[2];
+			pixel.a = in[3];
+			in += 4;
+		}
+		else
+		{
+			switch(op & OP_MASK)
+			{
+				case OP_INDEX:
+					pixel = index[op];
+				break;
+
+				case OP_DIFF:
+					pixel.r += static_cast<uint8_t>(((op >> 4) & 0x03) - 2);
+					pixel.g += static_cast<uint8_t>(((op >> 2) & 0x03) - 2);
+					pixel.b += static_cast<uint8_t>((op & 0x03) - 2);
+				break;
+
+				case OP_LUMA:
+				{
+					if(in >= end)
+					{
+						return false;
+					}
+
+					uint8_t rb = *in++;
+					int dg = (op & 0x3F) - 32;
+					pixel.r += static_cast<uint8_t>(dg - 8 + ((rb >> 4) & 0x0F));
+					pixel.g += static_cast<uint8_t>(dg);
+					pixel.b += static_cast<uint8_t>(dg - 8 + (rb & 0x0F));
+				}
+				break;
+
+				case OP_RUN:
+					run = (op & 0x3F) + 1;
+				break;
+			}
+		}
+
+		index[IndexOf(pixel)] = pixel;
+
+		if(static_cast<size_t>(outEnd - out) < run * 4)
+		{
+			return false;
+		}
+
+		for(uint32_t i = 0; i < run; ++i)
+		{
+			memcpy(out, &pixel, 4);
+			out += 4;
+		}
+	}
+
+	return true;
+}
+
+bool DecodeImage(const CompressedImageView& image, ThreadPool* noptrThreadPool, const DecodedChunkFunc& decodedChunk)
+{
+	const uint32_t numChunks = image.NumChunks();
+
+	if(numChunks == 0)
+	{
+		return false;
+	}
+
+	auto state = std::make_shared<DecodeState>();
+	state->image = image;
+	state->numChunks = numChunks;
+	state->noptrDecodedChunk = &decodedChunk;
+
+	if(noptrThreadPool && numChunks > 1)
+	{
+		size_t numHelpers = noptrThreadPool->NumThreads() < numChunks - 1 ? noptrThreadPool->NumThreads() : numChunks - 1;
+
+		for(size_t i = 0; i < numHelpers; ++i)
+		{
+			//The state is shared so a helper that only gets to run after we've returned still has something to look at
+			noptrThreadPool->Submit([state]{ DecodeChunks(*state); });
+		}
+	}
+
+	DecodeChunks(*state);
+
+	std::unique_lock<std::mutex> lock(state->mutex);
+	state->allFinished.wait(lock, [&state, numChunks]{ return state->finishedChunks == numChunks; });
+
+	return !state->failed;
+}
@@ -0,0 +1,87 @@
+/*
+ * ImageCodec.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_IMAGECODEC_H_
+#define UTILS_IMAGECODEC_H_
+
+#include <vector>
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+class ThreadPool;
+
+//Compressed image (.aimg) written by Tools/ImageCompressor, shared by the game and the tool.
+//
+//	CompressedImageHeader
+//	CompressedImageChunk[numChunks]
+//	chunk streams
+//
+//Every chunk holds rowsPerChunk rows (the last one may be shorter) of RGBA pixels coded with a
+//QOI style byte stream. The coder state starts fresh for each chunk so they decode independently.
+//Bump COMPRESSED_IMAGE_VERSION whenever the layout or the coding changes.
+
+static const char COMPRESSED_IMAGE_MAGIC[4] = {'A', 'I', 'M', 'G'};
+static const uint32_t COMPRESSED_IMAGE_VERSION = 1;
+static const uint32_t COMPRESSED_IMAGE_DEFAULT_ROWS_PER_CHUNK = 32;
+static const char COMPRESSED_IMAGE_EXTENSION[] = ".aimg";
+
+struct CompressedImageHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t width;
+	uint32_t height;
+	uint32_t rowsPerChunk;
+	uint32_t numChunks;
+};
+
+struct CompressedImageChunk
+{
+	uint32_t offset; //from the start of the file
+	uint32_t size;
+};
+
+static_assert(sizeof(CompressedImageHeader) == 24, "CompressedImageHeader layout changed");
+static_assert(sizeof(CompressedImageChunk) == 8, "CompressedImageChunk layout changed");
+
+//rgba is width * height * 4 bytes, top down
+std::vector<uint8_t> EncodeImage(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t rowsPerChunk = COMPRESSED_IMAGE_DEFAULT_ROWS_PER_CHUNK);
+
+//Read only view of an encoded image, data has to outlive it
+class CompressedImageView
+{
+public:
+	CompressedImageView();
+
+	//False if it isn't a valid version COMPRESSED_IMAGE_VERSION image
+	bool Open(const uint8_t* data, size_t size);
+
+	inline uint32_t Width() const {return mnoptrHeader ? mnoptrHeader->width : 0;}
+	inline uint32_t Height() const {return mnoptrHeader ? mnoptrHeader->height : 0;}
+	inline uint32_t NumChunks() const {return mnoptrHeader ? mnoptrHeader->numChunks : 0;}
+	uint32_t ChunkFirstRow(uint32_t chunk) const;
+	uint32_t ChunkNumRows(uint32_t chunk) const;
+
+	//Decodes the chunk's rows into rgba, which needs room for ChunkNumRows(chunk) * Width() pixels
+	bool DecodeChunk(uint32_t chunk, uint8_t* rgba) const;
+
+private:
+	const uint8_t* mnoptrData;
+	size_t mSize;
+	const CompressedImageHeader* mnoptrHeader;
+	const CompressedImageChunk* mnoptrChunks;
+};
+
+//Called with each decoded chunk, from whichever thread decoded it. rgba is only valid during the call.
+using DecodedChunkFunc = std::function<void(uint32_t firstRow, uint32_t numRows, const uint8_t* rgba)>;
+
+//Decodes every chunk, sharing them out with noptrThreadPool's workers when given one.
+//The calling thread decodes too and never waits on a job that hasn't started, so it's fine to call from a pool job.
+bool DecodeImage(const CompressedImageView& image, ThreadPool* noptrThreadPool, const DecodedChunkFunc& decodedChunk);
+
+#endif /* UTILS_IMAGECODEC_H_ */
@@ -0,0 +1,342 @@
+/*
+ * Profiler.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "Profiler.h"
+#include "Screen.h"
+#include "BitmapFont.h"
+#include <cstdio>
+
+namespace profiler
+{
+	std::string FormatOverlayMS(double milliseconds)
+	{
+		char buffer[16];
+
+		std::snprintf(buffer, sizeof(buffer), milliseconds < 10.0 ? "%.2f" : (milliseconds < 100.0 ? "%.1f" : "%.0f"), milliseconds);
+
+		return buffer;
+	}
+
+	void DrawOverlayRow(Screen& screen, const BitmapFont& font, float y, const std::string& name, const std::string columns[OVERLAY_NUM_COLUMNS], const Color& color)
+	{
+		screen.Draw(font, name, Vec2D(OVERLAY_NAME_X, y), color);
+
+		for(size_t i = 0; i < OVERLAY_NUM_COLUMNS; ++i)
+		{
+			screen.Draw(font, columns[i], Vec2D(OVERLAY_FIRST_COLUMN_X + OVERLAY_COLUMN_WIDTH * i, y), color);
+		}
+	}
+}
+
+#ifdef ARCADE_PROFILER
+
+#include "AARectangle.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+
+namespace
+{
+	struct Track
+	{
+		const char* name = nullptr;
+		uint64_t current = 0; //this frame so far
+		uint64_t history[profiler::HISTORY_FRAMES] = {};
+	};
+
+	struct Stats
+	{
+		uint64_t min = 0;
+		uint64_t avg = 0;
+		uint64_t max = 0;
+		uint64_t p99 = 0;
+	};
+
+	Track sFrame; //BeginFrame() to EndFrame()
+	Track sZones[profiler::MAX_ZONES];
+	Track sCounters[profiler::MAX_COUNTERS];
+	//Only grow, and only once the new slot's name is set
+	std::atomic<size_t> sNumZones(0);
+	std::atomic<size_t> sNumCounters(0);
+	std::mutex sRegisterMutex; //zones can be hit on worker threads too
+
+	//Not a slot in sZones - only so the frames show up in a trace
+	const profiler::ZoneId FRAME_ZONE_ID = profiler::MAX_ZONES;
+
+	size_t sHistoryIndex = 0; //where the next frame goes
+	size_t sNumFrames = 0; //in the history
+	uint64_t sFrameNumber = 0;
+	std::chrono::steady_clock::time_point sFrameStart;
+	bool sFrameTraced = false;
+	bool sOverlayVisible = false;
+
+	//Only ever set on the main thread, and not while the overlay draws itself
+	thread_local bool tRecording = false;
+
+	const size_t OVERLAY_MAX_NAME_LENGTH = 7; //whatever fits before the first column
+
+	uint16_t Register(Track* tracks, std::atomic<size_t>& numTracks, size_t maxTracks, const char* name)
+	{
+		std::lock_guard<std::mutex> lock(sRegisterMutex);
+
+		for(size_t i = 0; i < numTracks; ++i)
+		{
+			if(std::strcmp(tracks[i].name, name) == 0)
+			{
+				return static_cast<uint16_t>(i);
+			}
+		}
+
+		if(numTracks == maxTracks)
+		{
+			std::cout << "Profiler is out of slots, " << name << " goes in the last one" << std::endl;
+			return static_cast<uint16_t>(maxTracks - 1);
+		}
+
+		size_t index = numTracks.load();
+		tracks[index].name = name;
+		numTracks.store(index + 1);
+
+		return static_cast<uint16_t>(index);
+	}
+
+	void PushFrame(Track& track)
+	{
+		track.history[sHistoryIndex] = track.current;
+		track.current = 0;
+	}
+
+	Stats GetStats(const Track& track)
+	{
+		Stats stats;
+
+		if(sNumFrames == 0)
+		{
+			return stats;
+		}
+
+		uint64_t sorted[profiler::HISTORY_FRAMES];
+		std::copy(track.history, track.history + sNumFrames, sorted);
+		std::sort(sorted, sorted + sNumFrames);
+
+		uint64_t sum = 0;
+		for(size_t i = 0; i < sNumFrames; ++i)
+		{
+			sum += sorted[i];
+		}
+
+		//Nearest rank
+		size_t p99Rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(sNumFrames)));
+
+		stats.min = sorted[0];
+		stats.avg = sum / sNumFrames;
+		stats.max = sorted[sNumFrames - 1];
+		stats.p99 = sorted[std::max<size_t>(p99Rank, 1) - 1];
+
+		return stats;
+	}
+
+	std::string FormatMS(uint64_t nanoseconds)
+	{
+		return profiler::FormatOverlayMS(static_cast<double>(nanoseconds) / 1000000.0);
+	}
+
+	std::string FormatCount(uint64_t count)
+	{
+		char buffer[24];
+
+		if(count < 1000)
+		{
+			std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned>(count));
+		}
+		else if(count < 1000000)
+		{
+			std::snprintf(buffer, sizeof(buffer), "%uK", static_cast<unsigned>(count / 1000));
+		}
+		else
+		{
+			std::snprintf(buffer, sizeof(buffer), "%.1fM", static_cast<double>(count) / 1000000.0);
+		}
+
+		return buffer;
+	}
+
+	std::string ToOverlayName(const char* name)
+	{
+		std::string overlayName(name, std::min(std::strlen(name), OVERLAY_MAX_NAME_LENGTH));
+		std::transform(overlayName.begin(), overlayName.end(), overlayName.begin(), [](char c){
+			return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+		});
+
+		return overlayName;
+	}
+
+	void DrawTrack(Screen& screen, const BitmapFont& font, float y, const char* name, const Track& track, bool isTime, const Color& color)
+	{
+		Stats stats = GetStats(track);
+
+		std::string columns[profiler::OVERLAY_NUM_COLUMNS];
+
+		if(isTime)
+		{
+			columns[0] = FormatMS(stats.min);
+			columns[1] = FormatMS(stats.avg);
+			columns[2] = FormatMS(stats.max);
+			columns[3] = FormatMS(stats.p99);
+		}
+		else
+		{
+			columns[0] = FormatCount(stats.min);
+			columns[1] = FormatCount(stats.avg);
+			columns[2] = FormatCount(stats.max);
+			columns[3] = FormatCount(stats.p99);
+		}
+
+		profiler::DrawOverlayRow(screen, font, y, ToOverlayName(name), columns, color);
+	}
+}
+
+namespace profiler
+{
+	ZoneId RegisterZone(const char* name)
+	{
+		return Register(sZones, sNumZones, MAX_ZONES, name);
+	}
+
+	CounterId RegisterCounter(const char* name)
+	{
+		return Register(sCounters, sNumCounters, MAX_COUNTERS, name);
+	}
+
+	const char* GetZoneName(ZoneId zoneId)
+	{
+		if(zoneId == FRAME_ZONE_ID)
+		{
+			return "Frame";
+		}
+
+		//Written once when the zone is registered, before the id is handed out
+		return zoneId < MAX_ZONES && sZones[zoneId].name ? sZones[zoneId].name : "";
+	}
+
+	void AddZoneTime(ZoneId zoneId, uint64_t nanoseconds)
+	{
+		if(tRecording)
+		{
+			sZones[zoneId].current += nanoseconds;
+		}
+	}
+
+	void AddCounter(CounterId counterId, uint64_t amount)
+	{
+		if(tRecording)
+		{
+			sCounters[counterId].current += amount;
+		}
+	}
+
+	void BeginFrame()
+	{
+		tRecording = true;
+		sFrameStart = std::chrono::steady_clock::now();
+		sFrameTraced = TraceBegin(FRAME_ZONE_ID, sFrameStart);
+	}
+
+	void EndFrame()
+	{
+		std::chrono::steady_clock::time_point frameEnd = std::chrono::steady_clock::now();
+
+		if(sFrameTraced)
+		{
+			TraceEnd(FRAME_ZONE_ID, frameEnd);
+		}
+
+		sFrame.current = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(frameEnd - sFrameStart).count());
+		PushFrame(sFrame);
+
+		for(size_t i = 0; i < sNumZones; ++i)
+		{
+			PushFrame(sZones[i]);
+		}
+
+		for(size_t i = 0; i < sNumCounters; ++i)
+		{
+			PushFrame(sCounters[i]);
+		}
+
+		sHistoryIndex = (sHistoryIndex + 1) % HISTORY_FRAMES;
+		sNumFrames = std::min(sNumFrames + 1, HISTORY_FRAMES);
+		++sFrameNumber;
+	}
+
+	bool IsRecordingFrame()
+	{
+		return tRecording;
+	}
+
+	uint64_t NumFrames()
+	{
+		return sFrameNumber;
+	}
+
+	void ToggleOverlay()
+	{
+		sOverlayVisible = !sOverlayVisible;
+	}
+
+	bool IsOverlayVisible()
+	{
+		return sOverlayVisible;
+	}
+
+	void DrawOverlay(Screen& screen, const BitmapFont& font)
+	{
+		if(!sOverlayVisible)
+		{
+			return;
+		}
+
+		bool wasRecording = tRecording;
+		tRecording = false;
+
+		const size_t numRows = 2 + sNumZones + sNumCounters;
+		const uint32_t height = static_cast<uint32_t>(OVERLAY_LINE_HEIGHT * numRows + 2.0f);
+		//Not a constant up top - a Color needs the screen's pixel format
+		const Color background(0, 0, 0, OVERLAY_BACKGROUND_ALPHA);
+		screen.Draw(AARectangle(Vec2D::Zero, screen.Width(), height), background, true, background);
+
+		float y = 1.0f;
+
+		const std::string header[OVERLAY_NUM_COLUMNS] = {"MIN", "AVG", "MAX", "P99"};
+		DrawOverlayRow(screen, font, y, "MS", header, Color::Yellow());
+		y += OVERLAY_LINE_HEIGHT;
+
+		DrawTrack(screen, font, y, "Frame", sFrame, true, Color::White());
+		y += OVERLAY_LINE_HEIGHT;
+
+		for(size_t i = 0; i < sNumZones; ++i)
+		{
+			DrawTrack(screen, font, y, sZones[i].name, sZones[i], true, Color::White());
+			y += OVERLAY_LINE_HEIGHT;
+		}
+
+		for(size_t i = 0; i < sNumCounters; ++i)
+		{
+			DrawTrack(screen, font, y, sCounters[i].name, sCounters[i], false, Color::Cyan());
+			y += OVERLAY_LINE_HEIGHT;
+		}
+
+		tRecording = wasRecording;
+	}
+}
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Profiler.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_PROFILER_H_
+#define UTILS_PROFILER_H_
+
+//Frame profiler, only compiled in with ARCADE_PROFILER defined (premake5 --profiler). Without it every macro
+//below expands to nothing so the zones can stay in the code.
+//
+//	PROFILE_ZONE("Name");                 times the rest of the enclosing scope
+//	PROFILE_COUNTER_ADD("Name", amount);  adds to a counter for the current frame
+//
+//Zones and counters are summed per frame and kept for the last HISTORY_FRAMES frames, the overlay shows their
+//min/avg/max/p99 over those. Main thread only - zones and counters hit from any other thread are dropped.
+//
+//StartTrace() also records every zone, on any thread, as begin/end events and writes them out as a Chrome
+//trace (chrome://tracing or ui.perfetto.dev). ArcadeApp --trace <file.json> traces from before Screen::Init.
+//
+//ARCADE_TRACK_ALLOCATIONS (premake5 --track-allocations, brings the profiler in with it) replaces the global
+//operator new and delete to count allocations per frame and per zone, see ProfilerAllocations.cpp.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class Screen;
+class BitmapFont;
+class Color;
+
+//Built either way - the FrameStats overlay lays its rows out the same as the profiler's
+namespace profiler
+{
+	static const uint8_t OVERLAY_BACKGROUND_ALPHA = 170;
+	static const float OVERLAY_LINE_HEIGHT = 10.0f;
+	static const float OVERLAY_NAME_X = 2.0f;
+	static const float OVERLAY_FIRST_COLUMN_X = 70.0f;
+	static const float OVERLAY_COLUMN_WIDTH = 38.0f;
+	static const size_t OVERLAY_NUM_COLUMNS = 4;
+
+	//The font only has capitals, digits and a bit of punctuation - at most 4 characters, to fit a column
+	std::string FormatOverlayMS(double milliseconds);
+	//name at OVERLAY_NAME_X, then the columns
+	void DrawOverlayRow(Screen& screen, const BitmapFont& font, float y, const std::string& name, const std::string columns[OVERLAY_NUM_COLUMNS], const Color& color);
+}
+
+#ifdef ARCADE_PROFILER
+
+#include <chrono>
+
+namespace profiler
+{
+	using ZoneId = uint16_t;
+	using CounterId = uint16_t;
+
+	static const size_t MAX_ZONES = 64;
+	static const size_t MAX_COUNTERS = 16;
+	static const size_t HISTORY_FRAMES = 120;
+
+	//Same name gives the same id. The macros register once per call site.
+	ZoneId RegisterZone(const char* name);
+	CounterId RegisterCounter(const char* name);
+
+	const char* GetZoneName(ZoneId zoneId);
+
+	void AddZoneTime(ZoneId zoneId, uint64_t nanoseconds);
+	void AddCounter(CounterId counterId, uint64_t amount);
+
+	//Around everything the App does in a frame, EndFrame() pushes the frame's totals into the history
+	void BeginFrame();
+	void EndFrame();
+	//True on the main thread once the first frame has begun, except while the overlay draws
+	bool IsRecordingFrame();
+	uint64_t NumFrames();
+
+	void ToggleOverlay();
+	bool IsOverlayVisible();
+	//Top left of the screen, nothing if the overlay is hidden. What it draws itself isn't counted.
+	void DrawOverlay(Screen& screen, const BitmapFont& font);
+
+	//Events go into a ring buffer per thread, a writer thread moves them to filePath as they come in.
+	//False if the file can't be written or a trace is already running.
+	bool StartTrace(const std::string& filePath);
+	//Writes out what's left and closes the file. Zones still open are left without their end.
+	void StopTrace();
+	bool IsTracing();
+
+	//What ScopedZone uses - false if the event wasn't recorded, not tracing or no room in the thread's buffer
+	//for it and its end, in which case don't record its end either. A true keeps the end's slot until TraceEnd
+	bool TraceBegin(ZoneId zoneId, std::chrono::steady_clock::time_point time);
+	void TraceEnd(ZoneId zoneId, std::chrono::steady_clock::time_point time);
+
+#ifdef ARCADE_TRACK_ALLOCATIONS
+	//Allocations are put down to the innermost zone open on their thread. EnterZone() returns the one it replaces.
+	ZoneId EnterZone(ZoneId zoneId);
+	void LeaveZone(ZoneId previousZoneId);
+	//Top allocating zones, the largest allocations and the most frequent sampled call sites, to stdout
+	void ReportAllocations();
+#endif
+
+	class ScopedZone
+	{
+	public:
+		explicit ScopedZone(ZoneId zoneId): mZoneId(zoneId), mStart(std::chrono::steady_clock::now()), mTraced(TraceBegin(zoneId, mStart))
+		{
+#ifdef ARCADE_TRACK_ALLOCATIONS
+			mPreviousZoneId = EnterZone(zoneId);
+#endif
+		}
+
+		~ScopedZone()
+		{
+#ifdef ARCADE_TRACK_ALLOCATIONS
+			LeaveZone(mPreviousZoneId);
+#endif
+			std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+			AddZoneTime(mZoneId, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - mStart).count()));
+
+			if(mTraced)
+			{
+				TraceEnd(mZoneId, end);
+			}
+		}
+
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		ZoneId mZoneId;
+		std::chrono::steady_clock::time_point mStart;
+		bool mTraced;
+#ifdef ARCADE_TRACK_ALLOCATIONS
+		ZoneId mPreviousZoneId;
+#endif
+	};
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#define PROFILE_ZONE(name) \
+	static const profiler::ZoneId PROFILE_CONCAT(profileZoneId, __LINE__) = profiler::RegisterZone(name); \
+	profiler::ScopedZone PROFILE_CONCAT(profileZone, __LINE__)(PROFILE_CONCAT(profileZoneId, __LINE__))
+
+#define PROFILE_COUNTER_ADD(name, amount) \
+	do { \
+		static const profiler::CounterId profileCounterId = profiler::RegisterCounter(name); \
+		profiler::AddCounter(profileCounterId, static_cast<uint64_t>(amount)); \
+	} while(0)
+
+#define PROFILE_BEGIN_FRAME() profiler::BeginFrame()
+#define PROFILE_END_FRAME() profiler::EndFrame()
+#define PROFILE_DRAW_OVERLAY(screen, font) profiler::DrawOverlay(screen, font)
+
+#else
+
+#define PROFILE_ZONE(name)
+#define PROFILE_COUNTER_ADD(name, amount) do {} while(0)
+#define PROFILE_BEGIN_FRAME() do {} while(0)
+#define PROFILE_END_FRAME() do {} while(0)
+#define PROFILE_DRAW_OVERLAY(screen, font) do {} while(0)
+
+#endif
+
+#endif /* UTILS_PROFILER_H_ */
@@ -0,0 +1,468 @@
+/*
+ * ProfilerAllocations.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "Profiler.h"
+
+#if defined(ARCADE_PROFILER) && defined(ARCADE_TRACK_ALLOCATIONS)
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <execinfo.h>
+#endif
+
+//Every operator new in the program comes through here. Each allocation is counted against the innermost zone
+//open on its thread, and on the main thread against the frame ("Allocs" and "Bytes" on the overlay).
+//The main thread also keeps the call stacks of its largest allocations, and of every SAMPLE_INTERVAL-th
+//allocation to find what keeps allocating frame after frame. Nothing here may allocate with new.
+
+namespace
+{
+	const profiler::ZoneId OUTSIDE_ZONES = profiler::MAX_ZONES; //the last slot, allocations with no zone open
+
+	const size_t OUTLIER_BYTES = 64 * 1024;
+	const uint64_t SAMPLE_INTERVAL = 1009; //prime so it doesn't fall in step with a loop
+	const int MAX_STACK_DEPTH = 12;
+	const int SKIPPED_STACK_FRAMES = 2; //the hook itself - with less inlining, as in Debug, a few more of its frames show
+	const size_t MAX_OUTLIERS = 16;
+	const size_t MAX_CALL_SITES = 64;
+	const size_t NUM_REPORTED_ZONES = 10;
+	const size_t NUM_REPORTED_CALL_SITES = 10;
+
+	struct ZoneAllocations
+	{
+		std::atomic<uint64_t> count;
+		std::atomic<uint64_t> bytes;
+	};
+
+	struct CallStack
+	{
+		void* frames[MAX_STACK_DEPTH];
+		int depth = 0;
+	};
+
+	struct Outlier
+	{
+		CallStack stack;
+		size_t bytes = 0; //the largest from this call stack
+		uint64_t count = 0;
+		profiler::ZoneId zoneId = OUTSIDE_ZONES;
+		uint64_t frame = 0; //the latest
+	};
+
+	struct CallSite
+	{
+		CallStack stack;
+		uint64_t hits = 0;
+		uint64_t bytes = 0;
+	};
+
+	//Any thread
+	ZoneAllocations sZoneAllocations[profiler::MAX_ZONES + 1];
+	thread_local profiler::ZoneId tCurrentZone = OUTSIDE_ZONES;
+	thread_local bool tInHook = false; //whatever the hook itself calls can't recurse into it
+
+	//Main thread only
+	Outlier sOutliers[MAX_OUTLIERS]; //the largest so far, one per call stack
+	size_t sNumOutliers = 0;
+	CallSite sCallSites[MAX_CALL_SITES];
+	size_t sNumCallSites = 0;
+	uint64_t sAllocationsToNextSample = SAMPLE_INTERVAL;
+
+	void CaptureStack(CallStack& stack)
+	{
+#ifdef _WIN32
+		stack.depth = CaptureStackBackTrace(SKIPPED_STACK_FRAMES, MAX_STACK_DEPTH, stack.frames, nullptr);
+#else
+		void* frames[MAX_STACK_DEPTH + SKIPPED_STACK_FRAMES];
+		int depth = backtrace(frames, MAX_STACK_DEPTH + SKIPPED_STACK_FRAMES);
+
+		stack.depth = std::max(depth - SKIPPED_STACK_FRAMES, 0);
+		std::copy(frames + (depth - stack.depth), frames + depth, stack.frames);
+#endif
+	}
+
+	bool IsSameStack(const CallStack& a, const CallStack& b)
+	{
+		return a.depth == b.depth && std::equal(a.frames, a.frames + a.depth, b.frames);
+	}
+
+	void PrintStack(const CallStack& stack)
+	{
+#ifdef _WIN32
+		for(int i = 0; i < stack.depth; ++i)
+		{
+			std::printf("\t\t%p\n", stack.frames[i]);
+		}
+#else
+		//malloc'd, not new'd - build with -rdynamic for function names
+		char** symbols = backtrace_symbols(stack.frames, stack.depth);
+
+		for(int i = 0; i < stack.depth; ++i)
+		{
+			std::printf("\t\t%s\n", symbols ? symbols[i] : "?");
+		}
+
+		std::free(symbols);
+#endif
+	}
+
+	void RecordOutlier(size_t bytes, profiler::ZoneId zoneId)
+	{
+		CallStack stack;
+		CaptureStack(stack);
+
+		//The same big allocation every frame is one outlier, not the whole list
+		for(size_t i = 0; i < sNumOutliers; ++i)
+		{
+			if(IsSameStack(sOutliers[i].stack, stack))
+			{
+				sOutliers[i].bytes = std::max(sOutliers[i].bytes, bytes);
+				++sOutliers[i].count;
+				sOutliers[i].frame = profiler::NumFrames();
+				return;
+			}
+		}
+
+		size_t slot = sNumOutliers;
+
+		if(sNumOutliers == MAX_OUTLIERS)
+		{
+			Outlier* smallest = std::min_element(sOutliers, sOutliers + MAX_OUTLIERS, [](const Outlier& a, const Outlier& b){
+				return a.bytes < b.bytes;
+			});
+
+			if(smallest->bytes >= bytes)
+			{
+				return;
+			}
+
+			slot = static_cast<size_t>(smallest - sOutliers);
+		}
+		else
+		{
+			++sNumOutliers;
+		}
+
+		Outlier& outlier = sOutliers[slot];
+		outlier.stack = stack;
+		outlier.bytes = bytes;
+		outlier.count = 1;
+		outlier.zoneId = zoneId;
+		outlier.frame = profiler::NumFrames();
+	}
+
+	void SampleCallSite(size_t bytes)
+	{
+		CallStack stack;
+		CaptureStack(stack);
+
+		for(size_t i = 0; i < sNumCallSites; ++i)
+		{
+			if(IsSameStack(sCallSites[i].stack, stack))
+			{
+				++sCallSites[i].hits;
+				sCallSites[i].bytes += bytes;
+				return;
+			}
+		}
+
+		//Once it's full only the call sites already found are counted - the steady ones show up early
+		if(sNumCallSites < MAX_CALL_SITES)
+		{
+			CallSite& callSite = sCallSites[sNumCallSites++];
+			callSite.stack = stack;
+			callSite.hits = 1;
+			callSite.bytes = bytes;
+		}
+	}
+
+	void RecordAllocation(size_t bytes)
+	{
+		if(tInHook)
+		{
+			return;
+		}
+
+		tInHook = true;
+
+		const profiler::ZoneId zoneId = tCurrentZone;
+		sZoneAllocations[zoneId].count.fetch_add(1, std::memory_order_relaxed);
+		sZoneAllocations[zoneId].bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+		if(profiler::IsRecordingFrame())
+		{
+			static const profiler::CounterId allocationsId = profiler::RegisterCounter("Allocs");
+			static const profiler::CounterId bytesId = profiler::RegisterCounter("Bytes");
+
+			profiler::AddCounter(allocationsId, 1);
+			profiler::AddCounter(bytesId, bytes);
+
+			if(bytes >= OUTLIER_BYTES)
+			{
+				RecordOutlier(bytes, zoneId);
+			}
+
+			if(--sAllocationsToNextSample == 0)
+			{
+				sAllocationsToNextSample = SAMPLE_INTERVAL;
+				SampleCallSite(bytes);
+			}
+		}
+
+		tInHook = false;
+	}
+
+	void* Allocate(size_t bytes)
+	{
+		RecordAllocation(bytes);
+
+		return std::malloc(bytes > 0 ? bytes : 1);
+	}
+
+	void* AllocateAligned(size_t bytes, std::align_val_t alignment)
+	{
+		RecordAllocation(bytes);
+
+		size_t align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+		bytes = bytes > 0 ? bytes : 1;
+
+#ifdef _WIN32
+		return _aligned_malloc(bytes, align);
+#else
+		void* ptr = nullptr;
+		return posix_memalign(&ptr, align, bytes) == 0 ? ptr : nullptr;
+#endif
+	}
+
+	void FreeAligned(void* ptr)
+	{
+#ifdef _WIN32
+		_aligned_free(ptr);
+#else
+		std::free(ptr);
+#endif
+	}
+
+	const char* GetAllocationZoneName(profiler::ZoneId zoneId)
+	{
+		return zoneId == OUTSIDE_ZONES ? "(no zone)" : profiler::GetZoneName(zoneId);
+	}
+}
+
+namespace profiler
+{
+	ZoneId EnterZone(ZoneId zoneId)
+	{
+		ZoneId previousZoneId = tCurrentZone;
+		tCurrentZone = zoneId;
+
+		return previousZoneId;
+	}
+
+	void LeaveZone(ZoneId previousZoneId)
+	{
+		tCurrentZone = previousZoneId;
+	}
+
+	void ReportAllocations()
+	{
+		//Printing allocates, keep it out of the numbers
+		bool wasInHook = tInHook;
+		tInHook = true;
+
+		const uint64_t numFrames = std::max<uint64_t>(NumFrames(), 1);
+
+		struct ZoneTotal
+		{
+			ZoneId zoneId;
+			uint64_t count;
+			uint64_t bytes;
+		};
+
+		ZoneTotal zones[MAX_ZONES + 1];
+		for(size_t i = 0; i <= MAX_ZONES; ++i)
+		{
+			zones[i].zoneId = static_cast<ZoneId>(i);
+			zones[i].count = sZoneAllocations[i].count.load(std::memory_order_relaxed);
+			zones[i].bytes = sZoneAllocations[i].bytes.load(std::memory_order_relaxed);
+		}
+
+		std::sort(zones, zones + MAX_ZONES + 1, [](const ZoneTotal& a, const ZoneTotal& b){
+			return a.count > b.count;
+		});
+
+		std::printf("Allocations over %llu frames, top zones (the innermost zone open, on any thread):\n", static_cast<unsigned long long>(numFrames));
+
+		for(size_t i = 0; i < NUM_REPORTED_ZONES && zones[i].count > 0; ++i)
+		{
+			std::printf("\t%-12s %10llu allocations %8.1f per frame %12llu bytes\n",
+				GetAllocationZoneName(zones[i].zoneId),
+				static_cast<unsigned long long>(zones[i].count),
+				static_cast<double>(zones[i].count) / static_cast<double>(numFrames),
+				static_cast<unsigned long long>(zones[i].bytes));
+		}
+
+		Outlier outliers[MAX_OUTLIERS];
+		std::copy(sOutliers, sOutliers + sNumOutliers, outliers);
+		std::sort(outliers, outliers + sNumOutliers, [](const Outlier& a, const Outlier& b){
+			return a.bytes > b.bytes;
+		});
+
+		std::printf("Largest allocations on the main thread (%llu bytes and up):\n", static_cast<unsigned long long>(OUTLIER_BYTES));
+
+		for(size_t i = 0; i < sNumOutliers; ++i)
+		{
+			std::printf("\t%llu bytes in %s, %llu times, last in frame %llu\n",
+				static_cast<unsigned long long>(outliers[i].bytes),
+				GetAllocationZoneName(outliers[i].zoneId),
+				static_cast<unsigned long long>(outliers[i].count),
+				static_cast<unsigned long long>(outliers[i].frame));
+			PrintStack(outliers[i].stack);
+		}
+
+		CallSite callSites[MAX_CALL_SITES];
+		std::copy(sCallSites, sCallSites + sNumCallSites, callSites);
+		std::sort(callSites, callSites + sNumCallSites, [](const CallSite& a, const CallSite& b){
+			return a.hits > b.hits;
+		});
+
+		std::printf("Most sampled call sites on the main thread (1 in %llu allocations):\n", static_cast<unsigned long long>(SAMPLE_INTERVAL));
+
+		for(size_t i = 0; i < NUM_REPORTED_CALL_SITES && i < sNumCallSites; ++i)
+		{
+			std::printf("\t%llu samples, %llu bytes\n", static_cast<unsigned long long>(callSites[i].hits), static_cast<unsigned long long>(callSites[i].bytes));
+			PrintStack(callSites[i].stack);
+		}
+
+		tInHook = wasInHook;
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	void* ptr = Allocate(size);
+
+	if(!ptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	void* ptr = AllocateAligned(size, alignment);
+
+	if(!ptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+	FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	FreeAligned(ptr);
+}
+
+#endif
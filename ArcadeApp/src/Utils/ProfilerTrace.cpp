@@ -0,0 +1,277 @@
+/*
+ * ProfilerTrace.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "Profiler.h"
+
+#ifdef ARCADE_PROFILER
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const size_t TRACE_BUFFER_SIZE = 16384; //events per thread, a power of 2
+	const std::chrono::milliseconds TRACE_FLUSH_INTERVAL(5);
+
+	static_assert((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) == 0, "The trace buffers wrap with a mask");
+
+	enum TracePhase : uint8_t
+	{
+		TRACE_BEGIN = 0,
+		TRACE_END
+	};
+
+	struct TraceEvent
+	{
+		uint64_t time; //nanoseconds since the trace started
+		profiler::ZoneId zoneId;
+		TracePhase phase;
+	};
+
+	//One producer (its thread) and one consumer (the writer thread), so no locks - the owning thread
+	//only moves head and the writer only moves tail
+	struct TraceBuffer
+	{
+		TraceEvent events[TRACE_BUFFER_SIZE];
+		std::atomic<uint64_t> head{0};
+		std::atomic<uint64_t> tail{0};
+		uint64_t reservedEnds = 0; //slots kept for the ends of begins already in, owning thread only
+		uint32_t threadIndex = 0;
+		bool isMainThread = false;
+		bool named = false; //the writer's put out its thread name
+	};
+
+	//Buffers are made the first time a thread records while tracing and kept for good, a thread holds on to its own
+	std::vector<std::unique_ptr<TraceBuffer>> sBuffers;
+	std::mutex sBuffersMutex;
+	thread_local TraceBuffer* tBuffer = nullptr;
+
+	std::atomic<bool> sTracing(false);
+	std::chrono::steady_clock::time_point sTraceStart;
+	std::thread::id sMainThreadId;
+
+	FILE* soptrTraceFile = nullptr;
+	bool sFirstEvent = true;
+	std::thread sWriterThread;
+	std::mutex sWriterMutex;
+	std::condition_variable sWriterWake;
+	bool sStopWriter = false;
+
+	TraceBuffer* GetThreadBuffer()
+	{
+		if(!tBuffer)
+		{
+			std::lock_guard<std::mutex> lock(sBuffersMutex);
+
+			sBuffers.push_back(std::make_unique<TraceBuffer>());
+			tBuffer = sBuffers.back().get();
+			tBuffer->threadIndex = static_cast<uint32_t>(sBuffers.size());
+			tBuffer->isMainThread = std::this_thread::get_id() == sMainThreadId;
+		}
+
+		return tBuffer;
+	}
+
+	void Record(TraceBuffer* buffer, profiler::ZoneId zoneId, TracePhase phase, std::chrono::steady_clock::time_point time)
+	{
+		const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+
+		TraceEvent& event = buffer->events[head & (TRACE_BUFFER_SIZE - 1)];
+		event.time = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - sTraceStart).count());
+		event.zoneId = zoneId;
+		event.phase = phase;
+
+		buffer->head.store(head + 1, std::memory_order_release);
+	}
+
+	bool RecordBegin(profiler::ZoneId zoneId, std::chrono::steady_clock::time_point time)
+	{
+		if(!sTracing.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		TraceBuffer* buffer = GetThreadBuffer();
+
+		const uint64_t used = buffer->head.load(std::memory_order_relaxed) - buffer->tail.load(std::memory_order_acquire);
+
+		//Room for the begin and its end, on top of the ends already owed - the writer's behind, drop the pair
+		//rather than wait. A begin without its end would run to the end of the trace.
+		if(used + buffer->reservedEnds + 2 > TRACE_BUFFER_SIZE)
+		{
+			return false;
+		}
+
+		++buffer->reservedEnds;
+		Record(buffer, zoneId, TRACE_BEGIN, time);
+
+		return true;
+	}
+
+	//Only after RecordBegin() said yes on this thread, so there's a slot for it even if tracing stopped since
+	void RecordEnd(profiler::ZoneId zoneId, std::chrono::steady_clock::time_point time)
+	{
+		TraceBuffer* buffer = GetThreadBuffer();
+
+		--buffer->reservedEnds;
+		Record(buffer, zoneId, TRACE_END, time);
+	}
+
+	void WriteEventSeparator()
+	{
+		std::fputs(sFirstEvent ? "\n" : ",\n", soptrTraceFile);
+		sFirstEvent = false;
+	}
+
+	//Writer thread, or StopTrace() once that has finished
+	void Drain()
+	{
+		std::lock_guard<std::mutex> lock(sBuffersMutex);
+
+		for(const std::unique_ptr<TraceBuffer>& buffer : sBuffers)
+		{
+			if(!buffer->named)
+			{
+				WriteEventSeparator();
+
+				if(buffer->isMainThread)
+				{
+					std::fprintf(soptrTraceFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Main\"}}", buffer->threadIndex);
+				}
+				else
+				{
+					std::fprintf(soptrTraceFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}", buffer->threadIndex, buffer->threadIndex);
+				}
+
+				buffer->named = true;
+			}
+
+			uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+			const uint64_t head = buffer->head.load(std::memory_order_acquire);
+
+			for(; tail != head; ++tail)
+			{
+				const TraceEvent& event = buffer->events[tail & (TRACE_BUFFER_SIZE - 1)];
+
+				//ts is in microseconds
+				WriteEventSeparator();
+				std::fprintf(soptrTraceFile, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%u}",
+					profiler::GetZoneName(event.zoneId),
+					event.phase == TRACE_BEGIN ? 'B' : 'E',
+					static_cast<unsigned long long>(event.time / 1000),
+					static_cast<unsigned>(event.time % 1000),
+					buffer->threadIndex);
+			}
+
+			buffer->tail.store(tail, std::memory_order_release);
+		}
+	}
+
+	void WriterLoop()
+	{
+		std::unique_lock<std::mutex> lock(sWriterMutex);
+
+		while(!sStopWriter)
+		{
+			sWriterWake.wait_for(lock, TRACE_FLUSH_INTERVAL);
+			Drain();
+		}
+	}
+}
+
+namespace profiler
+{
+	bool StartTrace(const std::string& filePath)
+	{
+		if(sTracing)
+		{
+			std::cout << "Already tracing" << std::endl;
+			return false;
+		}
+
+		soptrTraceFile = std::fopen(filePath.c_str(), "w");
+
+		if(!soptrTraceFile)
+		{
+			std::cout << "Could not open " << filePath << " for the trace" << std::endl;
+			return false;
+		}
+
+		std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", soptrTraceFile);
+		sFirstEvent = true;
+
+		{
+			//Threads that traced before pick up where their buffer is, just need naming again
+			std::lock_guard<std::mutex> lock(sBuffersMutex);
+
+			for(const std::unique_ptr<TraceBuffer>& buffer : sBuffers)
+			{
+				buffer->tail.store(buffer->head.load());
+				buffer->named = false;
+			}
+		}
+
+		sMainThreadId = std::this_thread::get_id();
+		sTraceStart = std::chrono::steady_clock::now();
+		sStopWriter = false;
+		sWriterThread = std::thread(WriterLoop);
+
+		sTracing = true;
+
+		std::cout << "Tracing to " << filePath << std::endl;
+
+		return true;
+	}
+
+	void StopTrace()
+	{
+		if(!sTracing)
+		{
+			return;
+		}
+
+		sTracing = false;
+
+		{
+			std::lock_guard<std::mutex> lock(sWriterMutex);
+			sStopWriter = true;
+		}
+
+		sWriterWake.notify_one();
+		sWriterThread.join();
+
+		//Whatever came in after the writer's last pass
+		Drain();
+
+		std::fputs("\n]}\n", soptrTraceFile);
+		std::fclose(soptrTraceFile);
+		soptrTraceFile = nullptr;
+	}
+
+	bool IsTracing()
+	{
+		return sTracing;
+	}
+
+	bool TraceBegin(ZoneId zoneId, std::chrono::steady_clock::time_point time)
+	{
+		return RecordBegin(zoneId, time);
+	}
+
+	void TraceEnd(ZoneId zoneId, std::chrono::steady_clock::time_point time)
+	{
+		RecordEnd(zoneId, time);
+	}
+}
+
+#endif
@@ -15,12 +15,12 @@ void Ray2D::Init(const Vec2D& origin, const Vec2D& velocity)
 	mVelocity = velocity;
 }
 
-Line2D Ray2D::GetLineSegmentForTime(float t, ease::EasingFunc func /*= ease::EaseLinear*/) const
+Line2D Ray2D::GetLineSegmentForTime(float t, ease::EasingType easing /*= ease::EASE_LINEAR*/) const
 {
 	if (t > 0)
 	{
 		Line2D line;
-		Vec2D p2 = mOrigin + mVelocity * func(t);
+		Vec2D p2 = mOrigin + mVelocity * ease::Evaluate(easing, t);
 
 		line.SetP0(mOrigin);
 		line.SetP1(p2);
@@ -15,7 +15,7 @@ public:
 
 	void Init(const Vec2D& origin, const Vec2D& velocity);
 
-	Line2D GetLineSegmentForTime(float t, ease::EasingFunc func = ease::EaseLinear) const;
+	Line2D GetLineSegmentForTime(float t, ease::EasingType easing = ease::EASE_LINEAR) const;
 
 	bool Intersects(const Circle& circle, float& t1, float& t2) const;
 
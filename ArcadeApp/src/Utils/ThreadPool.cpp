@@ -0,0 +1,63 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(size_t numThreads): mStopping(false)
+{
+	if(numThreads == 0)
+	{
+		unsigned int numCores = std::thread::hardware_concurrency();
+		numThreads = numCores > 1 ? numCores - 1 : 1;
+	}
+
+	mWorkers.reserve(numThreads);
+
+	for(size_t i = 0; i < numThreads; ++i)
+	{
+		mWorkers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+	}
+
+	mJobAvailable.notify_all();
+
+	for(std::thread& worker : mWorkers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::WorkerLoop()
+{
+	for(;;)
+	{
+		std::function<void()> job;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mJobAvailable.wait(lock, [this]{ return mStopping || !mJobs.empty(); });
+
+			//Finish whatever was queued before shutting down, callers may be waiting on it
+			if(mJobs.empty())
+			{
+				return;
+			}
+
+			job = std::move(mJobs.front());
+			mJobs.pop_front();
+		}
+
+		job();
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * ThreadPool.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_THREADPOOL_H_
+#define UTILS_THREADPOOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+//Fixed set of worker threads pulling jobs off one queue. Jobs are started in the order they're submitted.
+//Nothing in here touches SDL or the Screen - jobs must only use things that are safe off the main thread.
+class ThreadPool
+{
+public:
+	//0 - one thread per core, leaving one for the main thread
+	explicit ThreadPool(size_t numThreads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	template<typename Job>
+	std::future<std::invoke_result_t<Job>> Submit(Job&& job);
+
+	inline size_t NumThreads() const {return mWorkers.size();}
+
+private:
+
+	void WorkerLoop();
+
+	std::vector<std::thread> mWorkers;
+	std::deque<std::function<void()>> mJobs;
+	std::mutex mMutex;
+	std::condition_variable mJobAvailable;
+	bool mStopping;
+};
+
+template<typename Job>
+std::future<std::invoke_result_t<Job>> ThreadPool::Submit(Job&& job)
+{
+	using Result = std::invoke_result_t<Job>;
+
+	//std::function has to be copyable, packaged_task isn't
+	auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Job>(job));
+	std::future<Result> result = task->get_future();
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mJobs.emplace_back([task]{ (*task)(); });
+	}
+
+	mJobAvailable.notify_one();
+
+	return result;
+}
+
+#endif /* UTILS_THREADPOOL_H_ */
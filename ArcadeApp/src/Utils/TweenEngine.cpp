@@ -0,0 +1,233 @@
+/*
+ * TweenEngine.cpp
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#include "TweenEngine.h"
+#include "Profiler.h"
+#include "Utils.h"
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+	const uint32_t TWEEN_INDEX_BITS = 16;
+	const uint32_t TWEEN_INDEX_MASK = (1u << TWEEN_INDEX_BITS) - 1;
+
+	static_assert(TweenEngine::MAX_TWEENS <= TWEEN_INDEX_MASK, "Tween indices have to fit in a handle");
+
+	TweenHandle MakeHandle(uint16_t index, uint16_t generation)
+	{
+		return (static_cast<uint32_t>(generation) << TWEEN_INDEX_BITS) | index;
+	}
+}
+
+TweenEngine::TweenEngine(): mNumActive(0), mNumFree(MAX_TWEENS), mPeakActive(0)
+{
+	//Hand out the low slots first
+	for(size_t i = 0; i < MAX_TWEENS; ++i)
+	{
+		mFree[i] = static_cast<uint16_t>(MAX_TWEENS - 1 - i);
+	}
+}
+
+TweenHandle TweenEngine::Start(float* target, float from, float to, uint32_t durationMS, ease::EasingType easing, TweenCallback onComplete, void* userData)
+{
+	TweenHandle handle = Allocate(TWEEN_TARGET_FLOAT, target, durationMS, easing, onComplete, userData);
+
+	if(Tween* tween = Find(handle))
+	{
+		tween->fromFloat = from;
+		tween->toFloat = to;
+		*target = from;
+	}
+
+	return handle;
+}
+
+TweenHandle TweenEngine::Start(Vec2D* target, const Vec2D& from, const Vec2D& to, uint32_t durationMS, ease::EasingType easing, TweenCallback onComplete, void* userData)
+{
+	TweenHandle handle = Allocate(TWEEN_TARGET_VEC2D, target, durationMS, easing, onComplete, userData);
+
+	if(Tween* tween = Find(handle))
+	{
+		tween->fromVec = from;
+		tween->toVec = to;
+		*target = from;
+	}
+
+	return handle;
+}
+
+TweenHandle TweenEngine::Start(Color* target, const Color& from, const Color& to, uint32_t durationMS, ease::EasingType easing, TweenCallback onComplete, void* userData)
+{
+	TweenHandle handle = Allocate(TWEEN_TARGET_COLOR, target, durationMS, easing, onComplete, userData);
+
+	if(Tween* tween = Find(handle))
+	{
+		tween->fromColor = from;
+		tween->toColor = to;
+		*target = from;
+	}
+
+	return handle;
+}
+
+TweenHandle TweenEngine::StartTimer(uint32_t durationMS, TweenCallback onComplete, void* userData)
+{
+	return Allocate(TWEEN_TARGET_NONE, nullptr, durationMS, ease::EASE_LINEAR, onComplete, userData);
+}
+
+void TweenEngine::SetEasingFunc(TweenHandle handle, ease::EasingFunc easingFunc)
+{
+	if(Tween* tween = Find(handle))
+	{
+		tween->easingFunc = easingFunc;
+	}
+}
+
+void TweenEngine::Cancel(TweenHandle& handle)
+{
+	if(Tween* tween = Find(handle))
+	{
+		Deactivate(*tween);
+		Free(static_cast<uint16_t>(handle & TWEEN_INDEX_MASK));
+	}
+
+	handle = INVALID_TWEEN_HANDLE;
+}
+
+bool TweenEngine::IsActive(TweenHandle handle) const
+{
+	uint32_t index = handle & TWEEN_INDEX_MASK;
+
+	return handle != INVALID_TWEEN_HANDLE && index < MAX_TWEENS &&
+		   mTweens[index].inUse && mTweens[index].generation == (handle >> TWEEN_INDEX_BITS);
+}
+
+void TweenEngine::Update(uint32_t dt)
+{
+	PROFILE_ZONE("Tweens");
+
+	size_t numCompleted = 0;
+
+	for(size_t i = 0; i < mNumActive;)
+	{
+		Tween& tween = mTweens[mActive[i]];
+
+		tween.elapsed = std::min(tween.elapsed + dt, tween.duration);
+
+		const float t = tween.duration > 0 ? static_cast<float>(tween.elapsed) / static_cast<float>(tween.duration) : 1.0f;
+
+		//Back, elastic and bounce come from their tables, close enough for anything on screen
+		Apply(tween, tween.easingFunc ? tween.easingFunc(t) : ease::EvaluateTable(tween.easing, t));
+
+		if(tween.elapsed >= tween.duration)
+		{
+			//Swaps the last active tween into i, so don't move on
+			mCompleted[numCompleted++] = MakeHandle(mActive[i], tween.generation);
+			Deactivate(tween);
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	//After the pass so callbacks can start and cancel tweens - a callback cancelling another finished tween stops its callback too
+	for(size_t i = 0; i < numCompleted; ++i)
+	{
+		Tween* tween = Find(mCompleted[i]);
+
+		if(!tween)
+		{
+			continue;
+		}
+
+		TweenCallback onComplete = tween->onComplete;
+		void* userData = tween->userData;
+
+		Free(static_cast<uint16_t>(mCompleted[i] & TWEEN_INDEX_MASK));
+
+		if(onComplete)
+		{
+			onComplete(userData);
+		}
+	}
+}
+
+TweenHandle TweenEngine::Allocate(TweenTargetType targetType, void* target, uint32_t durationMS, ease::EasingType easing, TweenCallback onComplete, void* userData)
+{
+	if(mNumFree == 0)
+	{
+		std::cout << "Out of tweens, " << MAX_TWEENS << " are running" << std::endl;
+		return INVALID_TWEEN_HANDLE;
+	}
+
+	uint16_t index = mFree[--mNumFree];
+	Tween& tween = mTweens[index];
+	uint16_t generation = tween.generation;
+
+	tween = Tween();
+	tween.generation = generation;
+	tween.inUse = true;
+	tween.targetType = targetType;
+	tween.target = target;
+	tween.duration = durationMS;
+	tween.easing = easing;
+	tween.onComplete = onComplete;
+	tween.userData = userData;
+
+	tween.activeIndex = static_cast<uint16_t>(mNumActive);
+	mActive[mNumActive++] = index;
+	mPeakActive = std::max(mPeakActive, mNumActive);
+
+	return MakeHandle(index, generation);
+}
+
+TweenEngine::Tween* TweenEngine::Find(TweenHandle handle)
+{
+	return IsActive(handle) ? &mTweens[handle & TWEEN_INDEX_MASK] : nullptr;
+}
+
+void TweenEngine::Apply(const Tween& tween, float t) const
+{
+	switch(tween.targetType)
+	{
+		case TWEEN_TARGET_FLOAT:
+			*static_cast<float*>(tween.target) = Lerpf(tween.fromFloat, tween.toFloat, t);
+			break;
+		case TWEEN_TARGET_VEC2D:
+			*static_cast<Vec2D*>(tween.target) = Vec2D::Lerp(tween.fromVec, tween.toVec, t);
+			break;
+		case TWEEN_TARGET_COLOR:
+			*static_cast<Color*>(tween.target) = Color::Lerp(tween.fromColor, tween.toColor, t);
+			break;
+		default:
+			break;
+	}
+}
+
+void TweenEngine::Deactivate(Tween& tween)
+{
+	//Finished tweens stay in use until their callback has run, they're just not active any more
+	if(tween.activeIndex >= mNumActive || &mTweens[mActive[tween.activeIndex]] != &tween)
+	{
+		return;
+	}
+
+	uint16_t last = mActive[--mNumActive];
+	mActive[tween.activeIndex] = last;
+	mTweens[last].activeIndex = tween.activeIndex;
+}
+
+void TweenEngine::Free(uint16_t index)
+{
+	Tween& tween = mTweens[index];
+
+	tween.inUse = false;
+	++tween.generation;
+	mFree[mNumFree++] = index;
+}
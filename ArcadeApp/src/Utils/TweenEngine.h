@@ -0,0 +1,104 @@
+/*
+ * TweenEngine.h
+ *
+ *  Created on: Oct. 19, 2026
+ *      Author: serge
+ */
+
+#ifndef UTILS_TWEENENGINE_H_
+#define UTILS_TWEENENGINE_H_
+
+#include "Easings.h"
+#include "Vec2D.h"
+#include "Color.h"
+#include <stddef.h>
+#include <stdint.h>
+
+//Slot index in the low 16 bits, the slot's generation above so a handle to a finished tween goes stale
+using TweenHandle = uint32_t;
+static const TweenHandle INVALID_TWEEN_HANDLE = UINT32_MAX;
+
+//Called once when a tween reaches its end value, not when it's cancelled. A plain function pointer so starting
+//a tween never allocates - pass the object in userData.
+using TweenCallback = void(*)(void* userData);
+
+//Owned by the App. Animates a float, Vec2D or Color towards an end value, all tweens in one pass per update tick
+//after the scene's update, so the scene sees the new values when it draws. Tweens come from a fixed pool.
+//Whatever owns a target must Cancel() its tweens before the target goes away. Main thread only.
+class TweenEngine
+{
+public:
+	static const size_t MAX_TWEENS = 256;
+
+	TweenEngine();
+
+	TweenEngine(const TweenEngine&) = delete;
+	TweenEngine& operator=(const TweenEngine&) = delete;
+
+	//INVALID_TWEEN_HANDLE if the pool is used up. The target is set to from straight away.
+	TweenHandle Start(float* target, float from, float to, uint32_t durationMS, ease::EasingType easing = ease::EASE_LINEAR, TweenCallback onComplete = nullptr, void* userData = nullptr);
+	TweenHandle Start(Vec2D* target, const Vec2D& from, const Vec2D& to, uint32_t durationMS, ease::EasingType easing = ease::EASE_LINEAR, TweenCallback onComplete = nullptr, void* userData = nullptr);
+	TweenHandle Start(Color* target, const Color& from, const Color& to, uint32_t durationMS, ease::EasingType easing = ease::EASE_LINEAR, TweenCallback onComplete = nullptr, void* userData = nullptr);
+	//Nothing to animate, just calls onComplete after durationMS
+	TweenHandle StartTimer(uint32_t durationMS, TweenCallback onComplete, void* userData);
+
+	//For anything the EasingTypes don't cover - replaces the tween's easing
+	void SetEasingFunc(TweenHandle handle, ease::EasingFunc easingFunc);
+
+	//Leaves the target where it is. Safe with stale or invalid handles, sets handle to INVALID_TWEEN_HANDLE.
+	void Cancel(TweenHandle& handle);
+	bool IsActive(TweenHandle handle) const;
+
+	void Update(uint32_t dt);
+
+	inline size_t NumActive() const {return mNumActive;}
+	inline size_t PeakActive() const {return mPeakActive;}
+
+private:
+	enum TweenTargetType : uint8_t
+	{
+		TWEEN_TARGET_NONE = 0,
+		TWEEN_TARGET_FLOAT,
+		TWEEN_TARGET_VEC2D,
+		TWEEN_TARGET_COLOR
+	};
+
+	struct Tween
+	{
+		void* target = nullptr;
+		float fromFloat = 0.0f;
+		float toFloat = 0.0f;
+		Vec2D fromVec;
+		Vec2D toVec;
+		Color fromColor;
+		Color toColor;
+		uint32_t elapsed = 0;
+		uint32_t duration = 0;
+		ease::EasingFunc easingFunc = nullptr; //overrides easing when set
+		TweenCallback onComplete = nullptr;
+		void* userData = nullptr;
+		uint16_t generation = 0;
+		uint16_t activeIndex = 0; //where it is in mActive
+		ease::EasingType easing = ease::EASE_LINEAR;
+		TweenTargetType targetType = TWEEN_TARGET_NONE;
+		bool inUse = false;
+	};
+
+	TweenHandle Allocate(TweenTargetType targetType, void* target, uint32_t durationMS, ease::EasingType easing, TweenCallback onComplete, void* userData);
+	Tween* Find(TweenHandle handle);
+	void Apply(const Tween& tween, float t) const;
+	void Deactivate(Tween& tween);
+	void Free(uint16_t index);
+
+	Tween mTweens[MAX_TWEENS];
+	//Indices of the running tweens, packed at the front so Update() only walks those
+	uint16_t mActive[MAX_TWEENS];
+	uint16_t mFree[MAX_TWEENS];
+	//Tweens that finished this update, their callbacks run once the pass is done
+	TweenHandle mCompleted[MAX_TWEENS];
+	size_t mNumActive;
+	size_t mNumFree;
+	size_t mPeakActive;
+};
+
+#endif /* UTILS_TWEENENGINE_H_ */
@@ -55,6 +55,19 @@ bool StringCompare(const std::string& a, const std::string& b)
 	return false;
 }
 
+size_t StringCaseInsensitiveHash::operator()(const std::string& str) const
+{
+	//FNV-1a over the lower case characters
+	size_t hash = 2166136261u;
+
+	for(unsigned char c : str)
+	{
+		hash = (hash ^ static_cast<size_t>(std::tolower(c))) * 16777619u;
+	}
+
+	return hash;
+}
+
 float Clamp(float val, float min, float max)
 {
 	if(val > max)
@@ -113,7 +126,7 @@ Vec2D ConvertWorldSpaceToUVSpace(const Vec2D& worldPosition, const Vec2D& refPoi
 	return Vec2D(u, v);
 }
 
-void GetObjectAxis(const Vec2D& tl , uint32_t width, uint32_t height, float rotation, float scale, Vec2D& xAxis, Vec2D& yAxis, float& invXAxisLengthSq, float& invYAxisLengthSq, std::vector<Vec2D>& points)
+void GetObjectAxis(const Vec2D& tl , uint32_t width, uint32_t height, float rotation, float scale, Vec2D& xAxis, Vec2D& yAxis, float& invXAxisLengthSq, float& invYAxisLengthSq, std::array<Vec2D, 4>& points)
 {	
 	Vec2D topLeft = tl;
 	auto topRight = topLeft + Vec2D(width * scale, 0);
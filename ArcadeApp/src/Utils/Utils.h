@@ -10,6 +10,7 @@
 
 #include <string>
 #include <vector>
+#include <array>
 
 class Vec2D;
 
@@ -35,13 +36,24 @@ unsigned int GetIndex(unsigned int width, unsigned int r, unsigned int c);
 //string == string
 bool StringCompare(const std::string& a, const std::string& b);
 
+//Hash and equality matching StringCompare() - for maps keyed on names that are looked up case insensitively
+struct StringCaseInsensitiveHash
+{
+	size_t operator()(const std::string& str) const;
+};
+
+struct StringCaseInsensitiveEqual
+{
+	bool operator()(const std::string& a, const std::string& b) const {return StringCompare(a, b);}
+};
+
 float Clamp(float val, float min, float max);
 uint8_t Clamp8(uint8_t val, uint8_t min, uint8_t max);
 
 float Lerpf(float val1, float val2, float t);
 uint32_t LerpInt(uint32_t val1, uint32_t val2, float t);
 
-void GetObjectAxis(const Vec2D& tl, uint32_t width, uint32_t height, float rotation, float scale, Vec2D& xAxis, Vec2D& yAxis, float& invXAxisLengthSq, float& invYAxisLengthSq, std::vector<Vec2D>& points);
+void GetObjectAxis(const Vec2D& tl, uint32_t width, uint32_t height, float rotation, float scale, Vec2D& xAxis, Vec2D& yAxis, float& invXAxisLengthSq, float& invYAxisLengthSq, std::array<Vec2D, 4>& points);
 Vec2D ConvertWorldSpaceToUVSpace(const Vec2D& worldPosition, const Vec2D& refPoint, const Vec2D& xAxis, const Vec2D& yAxis, float invXAxisLengthSq, float invYAxisLengthSq);
 
 struct Size
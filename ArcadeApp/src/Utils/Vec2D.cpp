@@ -184,14 +184,22 @@ Vec2D Vec2D::GetCounterClockwisePerpendicularUnitVector() const
 	return Vec2D(-unitVec.mY, unitVec.mX);
 }
 
-Vec2D Vec2D::Lerp(const Vec2D& v1, const Vec2D& v2, float t, ease::EasingFunc func)
+Vec2D Vec2D::Lerp(const Vec2D& v1, const Vec2D& v2, float t)
 {
 	Vec2D r;
 
-	t = func(t);
-
 	r.SetX(Lerpf(v1.mX, v2.mX, t));
 	r.SetY(Lerpf(v1.mY, v2.mY, t));
 
 	return r;
 }
+
+Vec2D Vec2D::Lerp(const Vec2D& v1, const Vec2D& v2, float t, ease::EasingFunc func)
+{
+	return Lerp(v1, v2, func(t));
+}
+
+Vec2D Vec2D::Lerp(const Vec2D& v1, const Vec2D& v2, float t, ease::EasingType easing)
+{
+	return Lerp(v1, v2, ease::Evaluate(easing, t));
+}
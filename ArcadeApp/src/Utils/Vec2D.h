@@ -69,7 +69,9 @@ class Vec2D {
     Vec2D GetClockwisePerpendicularUnitVector() const;
     Vec2D GetCounterClockwisePerpendicularUnitVector() const;
 
+    static Vec2D Lerp(const Vec2D& v1, const Vec2D& v2, float t);
     static Vec2D Lerp(const Vec2D& v1, const Vec2D& v2, float t, ease::EasingFunc func);
+    static Vec2D Lerp(const Vec2D& v1, const Vec2D& v2, float t, ease::EasingType easing);
 
 
 
@@ -0,0 +1,943 @@
+//============================================================================
+// Name        : AssetPacker.cpp
+// Description : Offline asset packer. Converts every asset in the assets
+//               directory - bmps, sprite sheet sections, animations, the
+//               Pac-Man level and the Breakout levels - into one versioned
+//               binary pack (see Utils/AssetPackFormat.h) that the game maps
+//               and uses in place. The text files stay the source of truth,
+//               rerun this whenever one of them changes.
+//
+// Usage       : AssetPacker <assets directory> [<output pack>]
+//               The output defaults to <assets directory>/Assets.pack
+//
+//               AssetPacker <assets directory> --embed <output .cpp> [--embed-images]
+//               Writes the same data as constexpr C++ tables instead, for
+//               builds with ARCADE_EMBEDDED_ASSETS (premake5 --embed-assets).
+//               The images are only written with --embed-images.
+//============================================================================
+
+#define SDL_MAIN_HANDLED
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstring>
+#include <stdint.h>
+#include "AssetPackFormat.h"
+#include "AssetPacker.h"
+#include "FileCommandLoader.h"
+#include "Color.h"
+#include "Vec2D.h"
+
+namespace
+{
+	template<class T>
+	void Append(std::vector<uint8_t>& buffer, const T& value)
+	{
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+	}
+
+	template<class T>
+	void AppendArray(std::vector<uint8_t>& buffer, const std::vector<T>& values)
+	{
+		if(!values.empty())
+		{
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values.data());
+			buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(T));
+		}
+	}
+
+	//Fixed size, '\0' padded string fields - the game reads them with strnlen so a name may fill the whole field
+	template<size_t N>
+	bool CopyName(char (&dest)[N], const std::string& src, const std::string& assetName)
+	{
+		memset(dest, 0, N);
+
+		if(src.length() > N)
+		{
+			std::cout << assetName << ": \"" << src << "\" is longer than " << N << " characters" << std::endl;
+			return false;
+		}
+
+		memcpy(dest, src.data(), src.length());
+		return true;
+	}
+
+	PackedColor ToPackedColor(const Color& color)
+	{
+		PackedColor packed;
+		packed.r = color.GetRed();
+		packed.g = color.GetGreen();
+		packed.b = color.GetBlue();
+		packed.a = color.GetAlpha();
+		return packed;
+	}
+
+	PackedVec2D ToPackedVec2D(const Vec2D& vec)
+	{
+		PackedVec2D packed;
+		packed.x = vec.GetX();
+		packed.y = vec.GetY();
+		return packed;
+	}
+
+	std::string FirstCommand(const std::string& path)
+	{
+		std::ifstream inFile(path);
+		std::string line;
+
+		while(std::getline(inFile, line))
+		{
+			size_t commandPos = line.find(":");
+
+			if(commandPos != std::string::npos)
+			{
+				size_t endPos = line.find_first_of(" \r", commandPos);
+				return line.substr(commandPos + 1, endPos == std::string::npos ? std::string::npos : endPos - commandPos - 1);
+			}
+		}
+
+		return "";
+	}
+}
+
+bool PackImage(const std::string& path, PackEntry& entry)
+{
+	SDL_Surface* loadedSurface = SDL_LoadBMP(path.c_str());
+
+	if(loadedSurface == nullptr)
+	{
+		std::cout << "Could not load the image: " << path << " - " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	PackedImage image;
+	image.width = loadedSurface->w;
+	image.height = loadedSurface->h;
+	image.paletteSize = 0;
+	image.reserved = 0;
+
+	std::vector<PackedColor> palette;
+	std::vector<uint8_t> indices;
+	std::vector<PackedColor> pixels;
+
+	SDL_Palette* surfacePalette = loadedSurface->format->palette;
+
+	if(loadedSurface->format->BitsPerPixel == 8 && surfacePalette != nullptr)
+	{
+		for(int i = 0; i < surfacePalette->ncolors; ++i)
+		{
+			const SDL_Color& c = surfacePalette->colors[i];
+			palette.push_back({c.r, c.g, c.b, c.a});
+		}
+
+		SDL_LockSurface(loadedSurface);
+
+		for(uint32_t y = 0; y < image.height; ++y)
+		{
+			const uint8_t* row = static_cast<const uint8_t*>(loadedSurface->pixels) + y * loadedSurface->pitch;
+			indices.insert(indices.end(), row, row + image.width);
+		}
+
+		SDL_UnlockSurface(loadedSurface);
+		SDL_FreeSurface(loadedSurface);
+	}
+	else
+	{
+		SDL_Surface* surface = SDL_ConvertSurfaceFormat(loadedSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+		SDL_FreeSurface(loadedSurface);
+
+		if(surface == nullptr)
+		{
+			std::cout << "Could not convert the image: " << path << " - " << SDL_GetError() << std::endl;
+			return false;
+		}
+
+		SDL_LockSurface(surface);
+
+		for(uint32_t y = 0; y < image.height; ++y)
+		{
+			const uint32_t* row = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(surface->pixels) + y * surface->pitch);
+
+			for(uint32_t x = 0; x < image.width; ++x)
+			{
+				PackedColor c;
+				SDL_GetRGBA(row[x], surface->format, &c.r, &c.g, &c.b, &c.a);
+				pixels.push_back(c);
+			}
+		}
+
+		SDL_UnlockSurface(surface);
+		SDL_FreeSurface(surface);
+
+		//Same lossless quantization BMPImage does at load time
+		std::unordered_map<uint32_t, uint8_t> colorToIndex;
+		indices.reserve(pixels.size());
+
+		for(const PackedColor& c : pixels)
+		{
+			uint32_t key = (c.r << 24) | (c.g << 16) | (c.b << 8) | c.a;
+			auto iter = colorToIndex.find(key);
+
+			if(iter != colorToIndex.end())
+			{
+				indices.push_back(iter->second);
+				continue;
+			}
+
+			if(palette.size() == 256)
+			{
+				palette.clear();
+				indices.clear();
+				break;
+			}
+
+			uint8_t index = static_cast<uint8_t>(palette.size());
+			colorToIndex.emplace(key, index);
+			palette.push_back(c);
+			indices.push_back(index);
+		}
+	}
+
+	image.paletteSize = static_cast<uint32_t>(palette.size());
+
+	Append(entry.payload, image);
+
+	if(image.paletteSize > 0)
+	{
+		AppendArray(entry.payload, palette);
+		AppendArray(entry.payload, indices);
+	}
+	else
+	{
+		AppendArray(entry.payload, pixels);
+	}
+
+	entry.type = ASSET_PACK_IMAGE;
+	return true;
+}
+
+bool PackSpriteSections(const std::string& path, PackEntry& entry)
+{
+	std::vector<PackedSpriteSection> sections;
+	bool namesFit = true;
+
+	FileCommandLoader fileLoader;
+
+	Command spriteCommand;
+	spriteCommand.command = "sprite";
+	spriteCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			PackedSpriteSection section;
+			memset(&section, 0, sizeof(section));
+			sections.push_back(section);
+		};
+	fileLoader.AddCommand(spriteCommand);
+
+	Command keyCommand;
+	keyCommand.command = "key";
+	keyCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			namesFit = CopyName(sections.back().key, FileCommandLoader::ReadString(params), entry.name) && namesFit;
+		};
+	fileLoader.AddCommand(keyCommand);
+
+	struct IntField
+	{
+		const char* command;
+		uint32_t PackedSpriteSection::* field;
+	};
+
+	const IntField intFields[] = {
+		{"xPos", &PackedSpriteSection::xPos},
+		{"yPos", &PackedSpriteSection::yPos},
+		{"width", &PackedSpriteSection::width},
+		{"height", &PackedSpriteSection::height},
+		{"trimX", &PackedSpriteSection::trimX},
+		{"trimY", &PackedSpriteSection::trimY},
+		{"trimWidth", &PackedSpriteSection::trimWidth},
+		{"trimHeight", &PackedSpriteSection::trimHeight},
+	};
+
+	for(const IntField& intField : intFields)
+	{
+		Command command;
+		command.command = intField.command;
+		uint32_t PackedSpriteSection::* field = intField.field;
+		command.parseFunc = [&sections, field](ParseFuncParams params)
+			{
+				sections.back().*field = FileCommandLoader::ReadInt(params);
+			};
+		fileLoader.AddCommand(command);
+	}
+
+	if(!fileLoader.LoadFile(path) || !namesFit)
+	{
+		return false;
+	}
+
+	AppendArray(entry.payload, sections);
+	entry.type = ASSET_PACK_SPRITE_SECTIONS;
+	return true;
+}
+
+bool PackAnimations(const std::string& path, PackEntry& entry)
+{
+	std::vector<PackedAnimation> animations;
+	std::vector<PackedName> frameKeys;
+	std::vector<PackedColor> colors;
+	std::vector<PackedVec2D> offsets;
+
+	//Frame colors and overlay colors share one array, they're collected per animation and appended at the end of it
+	std::vector<PackedColor> frameColors;
+	std::vector<PackedColor> overlayColors;
+	bool namesFit = true;
+
+	auto FinishAnimation = [&]() {
+		if(animations.empty())
+		{
+			return;
+		}
+
+		PackedAnimation& animation = animations.back();
+		animation.firstFrameColor = static_cast<uint32_t>(colors.size());
+		animation.numFrameColors = static_cast<uint32_t>(frameColors.size());
+		colors.insert(colors.end(), frameColors.begin(), frameColors.end());
+
+		animation.firstOverlayColor = static_cast<uint32_t>(colors.size());
+		animation.numOverlayColors = static_cast<uint32_t>(overlayColors.size());
+		colors.insert(colors.end(), overlayColors.begin(), overlayColors.end());
+
+		frameColors.clear();
+		overlayColors.clear();
+	};
+
+	FileCommandLoader fileLoader;
+
+	Command animationCommand;
+	animationCommand.command = "animation";
+	animationCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			FinishAnimation();
+
+			PackedAnimation animation;
+			memset(&animation, 0, sizeof(animation));
+			namesFit = CopyName(animation.name, FileCommandLoader::ReadString(params), entry.name) && namesFit;
+			animation.firstFrameKey = static_cast<uint32_t>(frameKeys.size());
+			animation.firstFrameOffset = static_cast<uint32_t>(offsets.size());
+			animations.push_back(animation);
+		};
+	fileLoader.AddCommand(animationCommand);
+
+	Command spriteSheetCommand;
+	spriteSheetCommand.command = "sprite_sheet";
+	spriteSheetCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			namesFit = CopyName(animations.back().spriteSheet, FileCommandLoader::ReadString(params), entry.name) && namesFit;
+		};
+	fileLoader.AddCommand(spriteSheetCommand);
+
+	Command sizeCommand;
+	sizeCommand.command = "size";
+	sizeCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			animations.back().size = ToPackedVec2D(FileCommandLoader::ReadSize(params));
+		};
+	fileLoader.AddCommand(sizeCommand);
+
+	Command fpsCommand;
+	fpsCommand.command = "fps";
+	fpsCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			animations.back().fps = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(fpsCommand);
+
+	Command framesCommand;
+	framesCommand.command = "frame_keys";
+	framesCommand.commandType = COMMAND_MULTI_LINE;
+	framesCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			PackedName frameKey;
+			namesFit = CopyName(frameKey.name, std::string(params.line), entry.name) && namesFit;
+			frameKeys.push_back(frameKey);
+			animations.back().numFrameKeys++;
+		};
+	fileLoader.AddCommand(framesCommand);
+
+	Command overlayCommand;
+	overlayCommand.command = "overlay";
+	overlayCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			namesFit = CopyName(animations.back().overlay, FileCommandLoader::ReadString(params), entry.name) && namesFit;
+		};
+	fileLoader.AddCommand(overlayCommand);
+
+	Command frameColorsCommand;
+	frameColorsCommand.command = "frame_colors";
+	frameColorsCommand.commandType = COMMAND_MULTI_LINE;
+	frameColorsCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			frameColors.push_back(ToPackedColor(FileCommandLoader::ReadColor(params)));
+		};
+	fileLoader.AddCommand(frameColorsCommand);
+
+	Command overlayFrameColorCommand;
+	overlayFrameColorCommand.command = "overlay_colors";
+	overlayFrameColorCommand.commandType = COMMAND_MULTI_LINE;
+	overlayFrameColorCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			overlayColors.push_back(ToPackedColor(FileCommandLoader::ReadColor(params)));
+		};
+	fileLoader.AddCommand(overlayFrameColorCommand);
+
+	Command frameOffsetsCommand;
+	frameOffsetsCommand.command = "frame_offsets";
+	frameOffsetsCommand.commandType = COMMAND_MULTI_LINE;
+	frameOffsetsCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			offsets.push_back(ToPackedVec2D(FileCommandLoader::ReadSize(params)));
+			animations.back().numFrameOffsets++;
+		};
+	fileLoader.AddCommand(frameOffsetsCommand);
+
+	if(!fileLoader.LoadFile(path) || !namesFit)
+	{
+		return false;
+	}
+
+	FinishAnimation();
+
+	PackedAnimationsHeader header;
+	header.numAnimations = static_cast<uint32_t>(animations.size());
+	header.numFrameKeys = static_cast<uint32_t>(frameKeys.size());
+	header.numColors = static_cast<uint32_t>(colors.size());
+	header.numOffsets = static_cast<uint32_t>(offsets.size());
+
+	Append(entry.payload, header);
+	AppendArray(entry.payload, animations);
+	AppendArray(entry.payload, frameKeys);
+	AppendArray(entry.payload, colors);
+	AppendArray(entry.payload, offsets);
+
+	entry.type = ASSET_PACK_ANIMATIONS;
+	return true;
+}
+
+bool PackPacmanLevel(const std::string& path, PackEntry& entry)
+{
+	PackedPacmanLevelHeader header;
+	memset(&header, 0, sizeof(header));
+
+	std::vector<PackedPacmanTile> tiles;
+	std::vector<PackedBonusItem> bonusItems;
+	std::vector<std::string> layoutRows;
+	bool namesFit = true;
+
+	FileCommandLoader fileLoader;
+
+	Command bgImageCommand;
+	bgImageCommand.command = "bg_image";
+	bgImageCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			namesFit = CopyName(header.bgImage, FileCommandLoader::ReadString(params), entry.name) && namesFit;
+		};
+	fileLoader.AddCommand(bgImageCommand);
+
+	Command tileCommand;
+	tileCommand.command = "tile";
+	tileCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			PackedPacmanTile tile;
+			memset(&tile, 0, sizeof(tile));
+			tile.symbol = '-';
+			tiles.push_back(tile);
+		};
+	fileLoader.AddCommand(tileCommand);
+
+	Command tileHeightCommand;
+	tileHeightCommand.command = "tile_height";
+	tileHeightCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			header.tileHeight = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(tileHeightCommand);
+
+	Command layoutOffsetCommand;
+	layoutOffsetCommand.command = "layout_offset";
+	layoutOffsetCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			header.layoutOffset = ToPackedVec2D(FileCommandLoader::ReadSize(params));
+		};
+	fileLoader.AddCommand(layoutOffsetCommand);
+
+	Command tileSymbolCommand;
+	tileSymbolCommand.command = "tile_symbol";
+	tileSymbolCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			tiles.back().symbol = FileCommandLoader::ReadChar(params);
+		};
+	fileLoader.AddCommand(tileSymbolCommand);
+
+	Command tileToTeleportToCommand;
+	tileToTeleportToCommand.command = "tile_teleport_to_symbol";
+	tileToTeleportToCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			tiles.back().teleportToSymbol = FileCommandLoader::ReadChar(params);
+		};
+	fileLoader.AddCommand(tileToTeleportToCommand);
+
+	Command tileOffsetCommand;
+	tileOffsetCommand.command = "tile_offset";
+	tileOffsetCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			tiles.back().offset = ToPackedVec2D(FileCommandLoader::ReadSize(params));
+		};
+	fileLoader.AddCommand(tileOffsetCommand);
+
+	struct IntField
+	{
+		const char* command;
+		int32_t PackedPacmanTile::* field;
+	};
+
+	const IntField intFields[] = {
+		{"tile_width", &PackedPacmanTile::width},
+		{"tile_collision", &PackedPacmanTile::collidable},
+		{"tile_is_teleport_tile", &PackedPacmanTile::isTeleportTile},
+		{"tile_exclude_pellet", &PackedPacmanTile::excludePelletTile},
+		{"tile_pacman_spawn_point", &PackedPacmanTile::pacmanSpawnPoint},
+		{"tile_item_spawn_point", &PackedPacmanTile::itemSpawnPoint},
+		{"tile_blinky_spawn_point", &PackedPacmanTile::blinkySpawnPoint},
+		{"tile_pinky_spawn_point", &PackedPacmanTile::pinkySpawnPoint},
+		{"tile_inky_spawn_point", &PackedPacmanTile::inkySpawnPoint},
+		{"tile_clyde_spawn_point", &PackedPacmanTile::clydeSpawnPoint},
+		{"tile_is_gate", &PackedPacmanTile::isGate},
+	};
+
+	for(const IntField& intField : intFields)
+	{
+		Command command;
+		command.command = intField.command;
+		int32_t PackedPacmanTile::* field = intField.field;
+		command.parseFunc = [&tiles, field](ParseFuncParams params)
+			{
+				tiles.back().*field = FileCommandLoader::ReadInt(params);
+			};
+		fileLoader.AddCommand(command);
+	}
+
+	Command layoutCommand;
+	layoutCommand.command = "layout";
+	layoutCommand.commandType = COMMAND_MULTI_LINE;
+	layoutCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			layoutRows.push_back(std::string(params.line));
+		};
+	fileLoader.AddCommand(layoutCommand);
+
+	Command bonusItemCommand;
+	bonusItemCommand.command = "bonus_item";
+	bonusItemCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			PackedBonusItem bonusItem;
+			memset(&bonusItem, 0, sizeof(bonusItem));
+			bonusItems.push_back(bonusItem);
+		};
+	fileLoader.AddCommand(bonusItemCommand);
+
+	Command bonusItemSpriteNameCommand;
+	bonusItemSpriteNameCommand.command = "bonus_item_sprite_name";
+	bonusItemSpriteNameCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			namesFit = CopyName(bonusItems.back().spriteName, FileCommandLoader::ReadString(params), entry.name) && namesFit;
+		};
+	fileLoader.AddCommand(bonusItemSpriteNameCommand);
+
+	Command bonusItemScoreCommand;
+	bonusItemScoreCommand.command = "bonus_item_score";
+	bonusItemScoreCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			bonusItems.back().score = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(bonusItemScoreCommand);
+
+	Command bonusItemBeginLevelCommand;
+	bonusItemBeginLevelCommand.command = "bonus_item_begin_level";
+	bonusItemBeginLevelCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			bonusItems.back().begin = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(bonusItemBeginLevelCommand);
+
+	Command bonusItemEndLevelCommand;
+	bonusItemEndLevelCommand.command = "bonus_item_end_level";
+	bonusItemEndLevelCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			bonusItems.back().end = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(bonusItemEndLevelCommand);
+
+	if(!fileLoader.LoadFile(path) || !namesFit)
+	{
+		return false;
+	}
+
+	size_t rowLength = 0;
+
+	for(const std::string& row : layoutRows)
+	{
+		rowLength = std::max(rowLength, row.length());
+	}
+
+	header.numTiles = static_cast<uint32_t>(tiles.size());
+	header.numBonusItems = static_cast<uint32_t>(bonusItems.size());
+	header.numLayoutRows = static_cast<uint32_t>(layoutRows.size());
+	header.layoutRowLength = static_cast<uint32_t>(rowLength);
+
+	Append(entry.payload, header);
+	AppendArray(entry.payload, tiles);
+	AppendArray(entry.payload, bonusItems);
+
+	for(const std::string& row : layoutRows)
+	{
+		entry.payload.insert(entry.payload.end(), row.begin(), row.end());
+		entry.payload.insert(entry.payload.end(), rowLength - row.length(), '\0');
+	}
+
+	entry.type = ASSET_PACK_PACMAN_LEVEL;
+	return true;
+}
+
+bool PackBreakoutLevels(const std::string& path, PackEntry& entry)
+{
+	std::vector<PackedBreakoutLevel> levels;
+	std::vector<PackedBreakoutBlockType> blockTypes;
+	std::vector<std::string> rows;
+
+	FileCommandLoader fileLoader;
+
+	Command levelCommand;
+	levelCommand.command = "level";
+	levelCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			PackedBreakoutLevel level;
+			level.firstBlockType = static_cast<uint32_t>(blockTypes.size());
+			level.numBlockTypes = 0;
+			level.firstRow = static_cast<uint32_t>(rows.size());
+			level.numRows = 0;
+			levels.push_back(level);
+		};
+	fileLoader.AddCommand(levelCommand);
+
+	Command blockCommand;
+	blockCommand.command = "block";
+	blockCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			PackedBreakoutBlockType blockType;
+			memset(&blockType, 0, sizeof(blockType));
+			blockType.symbol = '-';
+			blockType.color = ToPackedColor(Color::Black());
+			blockTypes.push_back(blockType);
+			levels.back().numBlockTypes++;
+		};
+	fileLoader.AddCommand(blockCommand);
+
+	Command symbolCommand;
+	symbolCommand.command = "symbol";
+	symbolCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			blockTypes.back().symbol = FileCommandLoader::ReadChar(params);
+		};
+	fileLoader.AddCommand(symbolCommand);
+
+	Command fillColorCommand;
+	fillColorCommand.command = "fillcolor";
+	fillColorCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			blockTypes.back().color = ToPackedColor(FileCommandLoader::ReadColor(params));
+		};
+	fileLoader.AddCommand(fillColorCommand);
+
+	Command hpCommand;
+	hpCommand.command = "hp";
+	hpCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			blockTypes.back().hp = FileCommandLoader::ReadInt(params);
+		};
+	fileLoader.AddCommand(hpCommand);
+
+	Command layoutCommand;
+	layoutCommand.command = "layout";
+	layoutCommand.commandType = COMMAND_MULTI_LINE;
+	layoutCommand.parseFunc = [&](ParseFuncParams params)
+		{
+			rows.push_back(std::string(params.line));
+			levels.back().numRows++;
+		};
+	fileLoader.AddCommand(layoutCommand);
+
+	if(!fileLoader.LoadFile(path))
+	{
+		return false;
+	}
+
+	size_t rowLength = 0;
+
+	for(const std::string& row : rows)
+	{
+		rowLength = std::max(rowLength, row.length());
+	}
+
+	PackedBreakoutLevelsHeader header;
+	header.numLevels = static_cast<uint32_t>(levels.size());
+	header.numBlockTypes = static_cast<uint32_t>(blockTypes.size());
+	header.numRows = static_cast<uint32_t>(rows.size());
+	header.rowLength = static_cast<uint32_t>(rowLength);
+
+	Append(entry.payload, header);
+	AppendArray(entry.payload, levels);
+	AppendArray(entry.payload, blockTypes);
+
+	for(const std::string& row : rows)
+	{
+		entry.payload.insert(entry.payload.end(), row.begin(), row.end());
+		entry.payload.insert(entry.payload.end(), rowLength - row.length(), '-');
+	}
+
+	entry.type = ASSET_PACK_BREAKOUT_LEVELS;
+	return true;
+}
+
+bool HashSource(const std::filesystem::path& path, PackEntry& entry)
+{
+	std::ifstream inFile(path, std::ios::binary);
+
+	if(!inFile.is_open())
+	{
+		std::cout << "Could not open the file: " << path.string() << std::endl;
+		return false;
+	}
+
+	std::vector<uint8_t> contents((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+
+	entry.sourceSize = contents.size();
+	entry.sourceHash = AssetPackHash(contents.data(), contents.size());
+
+	return true;
+}
+
+bool PackAsset(const std::filesystem::path& path, PackEntry& entry)
+{
+	const std::string extension = path.extension().string();
+	const std::string pathStr = path.string();
+
+	if(extension == ".bmp")
+	{
+		return PackImage(pathStr, entry);
+	}
+
+	//Text assets are told apart by the first command in them
+	const std::string firstCommand = FirstCommand(pathStr);
+
+	if(firstCommand == "sprite")
+	{
+		return PackSpriteSections(pathStr, entry);
+	}
+	else if(firstCommand == "animation")
+	{
+		return PackAnimations(pathStr, entry);
+	}
+	else if(firstCommand == "bg_image" || firstCommand == "tile")
+	{
+		return PackPacmanLevel(pathStr, entry);
+	}
+	else if(firstCommand == "level")
+	{
+		return PackBreakoutLevels(pathStr, entry);
+	}
+
+	//Not an asset the game loads - leave the payload empty so it gets skipped
+	return true;
+}
+
+bool WritePack(const std::string& path, const std::vector<PackEntry>& packEntries)
+{
+	std::ofstream outFile(path, std::ios::binary);
+
+	if(!outFile.is_open())
+	{
+		std::cout << "Could not write the file: " << path << std::endl;
+		return false;
+	}
+
+	AssetPackHeader header;
+	memcpy(header.magic, ASSET_PACK_MAGIC, sizeof(header.magic));
+	header.version = ASSET_PACK_VERSION;
+	header.numEntries = static_cast<uint32_t>(packEntries.size());
+	header.entriesOffset = sizeof(AssetPackHeader);
+
+	auto Align = [](uint64_t offset) {
+		return (offset + ASSET_PACK_ALIGNMENT - 1) / ASSET_PACK_ALIGNMENT * ASSET_PACK_ALIGNMENT;
+	};
+
+	std::vector<AssetPackEntry> entries;
+	uint64_t offset = Align(header.entriesOffset + packEntries.size() * sizeof(AssetPackEntry));
+
+	for(const PackEntry& packEntry : packEntries)
+	{
+		AssetPackEntry entry;
+		memset(&entry, 0, sizeof(entry));
+		CopyName(entry.name, packEntry.name, packEntry.name);
+		entry.type = packEntry.type;
+		entry.offset = offset;
+		entry.size = packEntry.payload.size();
+		entry.sourceSize = packEntry.sourceSize;
+		entry.sourceHash = packEntry.sourceHash;
+		entries.push_back(entry);
+
+		offset = Align(offset + entry.size);
+	}
+
+	std::vector<uint8_t> pack;
+	pack.reserve(static_cast<size_t>(offset));
+
+	Append(pack, header);
+	AppendArray(pack, entries);
+
+	for(size_t i = 0; i < packEntries.size(); ++i)
+	{
+		pack.resize(static_cast<size_t>(entries[i].offset), 0);
+		AppendArray(pack, packEntries[i].payload);
+	}
+
+	pack.resize(static_cast<size_t>(offset), 0);
+
+	outFile.write(reinterpret_cast<const char*>(pack.data()), pack.size());
+
+	return outFile.good();
+}
+
+int main(int argc, char* argv[])
+{
+	const char* usage = "Usage: AssetPacker <assets directory> [<output pack>]\n"
+						"       AssetPacker <assets directory> --embed <output .cpp> [--embed-images]";
+
+	if(argc < 2)
+	{
+		std::cout << usage << std::endl;
+		return 1;
+	}
+
+	const std::filesystem::path assetsDir = argv[1];
+	std::string outputPath = (assetsDir / "Assets.pack").string();
+	std::string embedPath = "";
+	bool embedImages = false;
+
+	for(int i = 2; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+
+		if(arg == "--embed" && i + 1 < argc)
+		{
+			embedPath = argv[++i];
+		}
+		else if(arg == "--embed-images")
+		{
+			embedImages = true;
+		}
+		else if(arg.rfind("--", 0) != 0 && i == 2)
+		{
+			outputPath = arg;
+		}
+		else
+		{
+			std::cout << usage << std::endl;
+			return 1;
+		}
+	}
+
+	//ReadColor() builds Colors, they need a pixel format to pack into
+	SDL_PixelFormat* format = SDL_AllocFormat(SDL_PIXELFORMAT_ARGB8888);
+	Color::InitColorFormat(format);
+
+	std::vector<std::filesystem::path> assetPaths;
+	std::error_code error;
+
+	for(const auto& dirEntry : std::filesystem::directory_iterator(assetsDir, error))
+	{
+		const std::string extension = dirEntry.path().extension().string();
+
+		if(dirEntry.is_regular_file() && (extension == ".bmp" || extension == ".txt"))
+		{
+			assetPaths.push_back(dirEntry.path());
+		}
+	}
+
+	if(error)
+	{
+		std::cout << "Could not read the directory: " << assetsDir.string() << " - " << error.message() << std::endl;
+		SDL_FreeFormat(format);
+		return 1;
+	}
+
+	std::sort(assetPaths.begin(), assetPaths.end());
+
+	std::vector<PackEntry> packEntries;
+	int result = 0;
+
+	for(const std::filesystem::path& assetPath : assetPaths)
+	{
+		PackEntry entry;
+		entry.name = assetPath.filename().string();
+
+		if(entry.name.length() > ASSET_PACK_NAME_LENGTH)
+		{
+			std::cout << entry.name << ": file name is longer than " << ASSET_PACK_NAME_LENGTH << " characters, skipped" << std::endl;
+			continue;
+		}
+
+		if(!PackAsset(assetPath, entry) || !HashSource(assetPath, entry))
+		{
+			result = 1;
+			continue;
+		}
+
+		if(entry.payload.empty())
+		{
+			std::cout << entry.name << ": unknown asset, skipped" << std::endl;
+			continue;
+		}
+
+		std::cout << entry.name << ": " << entry.payload.size() << " bytes" << std::endl;
+		packEntries.push_back(std::move(entry));
+	}
+
+	SDL_FreeFormat(format);
+
+	if(!embedPath.empty())
+	{
+		if(!WriteEmbeddedTables(embedPath, packEntries, embedImages))
+		{
+			return 1;
+		}
+
+		std::cout << "Wrote the tables of " << packEntries.size() << " assets to " << embedPath << (embedImages ? "" : " (without the images)") << std::endl;
+		return result;
+	}
+
+	if(!WritePack(outputPath, packEntries))
+	{
+		return 1;
+	}
+
+	std::cout << "Wrote " << packEntries.size() << " assets to " << outputPath << std::endl;
+
+	return result;
+}
@@ -0,0 +1,30 @@
+//============================================================================
+// Name        : AssetPacker.h
+// Description : What the packer hands to its writers - the pack in
+//               AssetPacker.cpp and the C++ tables in EmbeddedTablesWriter.cpp
+//============================================================================
+
+#ifndef ASSETPACKER_H_
+#define ASSETPACKER_H_
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "AssetPackFormat.h"
+
+//payload is laid out exactly as it is in the pack, see Utils/AssetPackFormat.h
+struct PackEntry
+{
+	std::string name = "";
+	AssetPackEntryType type = ASSET_PACK_IMAGE;
+	std::vector<uint8_t> payload;
+	//Of the file the payload came from
+	uint64_t sourceSize = 0;
+	uint64_t sourceHash = 0;
+};
+
+//Writes the entries as constexpr tables (see Utils/AssetTables.h) for builds with ARCADE_EMBEDDED_ASSETS.
+//Images are big, they're only written when embedImages is set - otherwise the game reads them from the pack or the bmps.
+bool WriteEmbeddedTables(const std::string& path, const std::vector<PackEntry>& packEntries, bool embedImages);
+
+#endif /* ASSETPACKER_H_ */
@@ -0,0 +1,555 @@
+//============================================================================
+// Name        : EmbeddedTablesWriter.cpp
+// Description : Turns the pack entries into a C++ source file of constexpr
+//               tables - sprite rects, animation frame lists, level layouts
+//               and optionally the images - that builds with
+//               ARCADE_EMBEDDED_ASSETS compile in and load from with no
+//               file I/O or parsing.
+//============================================================================
+
+#include "AssetPacker.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cstring>
+#include <cctype>
+#include <cstdio>
+
+namespace
+{
+	const size_t NUMBERS_PER_LINE = 32;
+
+	std::string Identifier(const std::string& name)
+	{
+		std::string identifier = name;
+
+		for(char& c : identifier)
+		{
+			if(!isalnum(static_cast<unsigned char>(c)))
+			{
+				c = '_';
+			}
+		}
+
+		if(identifier.empty() || isdigit(static_cast<unsigned char>(identifier[0])))
+		{
+			identifier = "asset_" + identifier;
+		}
+
+		return identifier;
+	}
+
+	//Every character outside plain ASCII is written as a 3 digit octal escape so it can't run into the next one
+	std::string StringLiteral(const char* str, size_t length)
+	{
+		std::string literal = "\"";
+
+		for(size_t i = 0; i < length; ++i)
+		{
+			unsigned char c = static_cast<unsigned char>(str[i]);
+
+			if(c == '"' || c == '\\' || c == '?')
+			{
+				literal += '\\';
+				literal += static_cast<char>(c);
+			}
+			else if(c >= 0x20 && c < 0x7F)
+			{
+				literal += static_cast<char>(c);
+			}
+			else
+			{
+				char escape[5];
+				snprintf(escape, sizeof(escape), "\\%03o", c);
+				literal += escape;
+			}
+		}
+
+		return literal + "\"";
+	}
+
+	//A '\0' padded char[N] field. A name that fills the whole field has no room for the literal's '\0', it's spelled out instead.
+	template<size_t N>
+	std::string FieldLiteral(const char (&field)[N])
+	{
+		size_t length = strnlen(field, N);
+
+		if(length < N)
+		{
+			return StringLiteral(field, length);
+		}
+
+		std::string chars = "{";
+
+		for(size_t i = 0; i < N; ++i)
+		{
+			chars += (i > 0 ? ", " : "") + std::to_string(static_cast<int>(field[i]));
+		}
+
+		return chars + "}";
+	}
+
+	std::string CharLiteral(char c)
+	{
+		return "static_cast<char>(" + std::to_string(static_cast<int>(c)) + ")";
+	}
+
+	std::string FloatLiteral(float f)
+	{
+		std::ostringstream stream;
+		stream << std::setprecision(std::numeric_limits<float>::max_digits10) << f;
+		std::string literal = stream.str();
+
+		if(literal.find_first_of(".e") == std::string::npos)
+		{
+			literal += ".0";
+		}
+
+		return literal + "f";
+	}
+
+	std::string ToString(const PackedColor& c)
+	{
+		return "{" + std::to_string(c.r) + ", " + std::to_string(c.g) + ", " + std::to_string(c.b) + ", " + std::to_string(c.a) + "}";
+	}
+
+	std::string ToString(const PackedVec2D& v)
+	{
+		return "{" + FloatLiteral(v.x) + ", " + FloatLiteral(v.y) + "}";
+	}
+
+	std::string ToString(const PackedName& n)
+	{
+		return "{" + FieldLiteral(n.name) + "}";
+	}
+
+	std::string ToString(const PackedSpriteSection& s)
+	{
+		std::ostringstream stream;
+		stream << "{" << FieldLiteral(s.key) << ", " << s.xPos << ", " << s.yPos << ", " << s.width << ", " << s.height << ", "
+			   << s.trimX << ", " << s.trimY << ", " << s.trimWidth << ", " << s.trimHeight << "}";
+		return stream.str();
+	}
+
+	std::string ToString(const PackedAnimation& a)
+	{
+		std::ostringstream stream;
+		stream << "{" << FieldLiteral(a.name) << ", " << FieldLiteral(a.spriteSheet) << ", " << FieldLiteral(a.overlay) << ", "
+			   << ToString(a.size) << ", " << a.fps << ", "
+			   << a.firstFrameKey << ", " << a.numFrameKeys << ", " << a.firstFrameColor << ", " << a.numFrameColors << ", "
+			   << a.firstOverlayColor << ", " << a.numOverlayColors << ", " << a.firstFrameOffset << ", " << a.numFrameOffsets << "}";
+		return stream.str();
+	}
+
+	std::string ToString(const PackedPacmanTile& t)
+	{
+		std::ostringstream stream;
+		stream << "{" << ToString(t.offset) << ", " << t.width << ", " << t.collidable << ", " << t.isTeleportTile << ", " << t.excludePelletTile << ", "
+			   << t.pacmanSpawnPoint << ", " << t.itemSpawnPoint << ", " << t.blinkySpawnPoint << ", " << t.inkySpawnPoint << ", "
+			   << t.pinkySpawnPoint << ", " << t.clydeSpawnPoint << ", " << t.isGate << ", "
+			   << CharLiteral(t.teleportToSymbol) << ", " << CharLiteral(t.symbol) << ", {0, 0}}";
+		return stream.str();
+	}
+
+	std::string ToString(const PackedBonusItem& b)
+	{
+		std::ostringstream stream;
+		stream << "{" << FieldLiteral(b.spriteName) << ", " << b.score << ", " << b.begin << ", " << b.end << ", 0}";
+		return stream.str();
+	}
+
+	std::string ToString(const PackedBreakoutLevel& l)
+	{
+		std::ostringstream stream;
+		stream << "{" << l.firstBlockType << ", " << l.numBlockTypes << ", " << l.firstRow << ", " << l.numRows << "}";
+		return stream.str();
+	}
+
+	std::string ToString(const PackedBreakoutBlockType& b)
+	{
+		std::ostringstream stream;
+		stream << "{" << ToString(b.color) << ", " << b.hp << ", " << CharLiteral(b.symbol) << ", {0, 0, 0}}";
+		return stream.str();
+	}
+
+	//Reads the payload's arrays back in order, the same way the game splits them up
+	class PayloadReader
+	{
+	public:
+		explicit PayloadReader(const std::vector<uint8_t>& payload): mPayload(payload), mOffset(0), mValid(true) {}
+
+		template<class T>
+		T Read()
+		{
+			T value;
+			memset(&value, 0, sizeof(value));
+
+			if(mOffset + sizeof(T) > mPayload.size())
+			{
+				mValid = false;
+				return value;
+			}
+
+			memcpy(&value, mPayload.data() + mOffset, sizeof(T));
+			mOffset += sizeof(T);
+			return value;
+		}
+
+		template<class T>
+		std::vector<T> ReadArray(size_t count)
+		{
+			if(mOffset + count * sizeof(T) > mPayload.size())
+			{
+				mValid = false;
+				return {};
+			}
+
+			std::vector<T> values(count);
+
+			if(count > 0)
+			{
+				memcpy(values.data(), mPayload.data() + mOffset, count * sizeof(T));
+			}
+
+			mOffset += count * sizeof(T);
+			return values;
+		}
+
+		inline bool IsValid() const {return mValid;}
+
+	private:
+		const std::vector<uint8_t>& mPayload;
+		size_t mOffset;
+		bool mValid;
+	};
+
+	class TablesWriter
+	{
+	public:
+		explicit TablesWriter(std::ostream& out): mOut(out) {}
+
+		//Returns what the table should point at - the array's name, or nullptr when there's nothing to write
+		template<class T>
+		std::string Array(const std::string& identifier, const char* typeName, const std::vector<T>& values)
+		{
+			if(values.empty())
+			{
+				return "nullptr";
+			}
+
+			mOut << "\tconstexpr " << typeName << " " << identifier << "[] = {\n";
+
+			for(const T& value : values)
+			{
+				mOut << "\t\t" << ToString(value) << ",\n";
+			}
+
+			mOut << "\t};\n\n";
+
+			return identifier;
+		}
+
+		std::string Bytes(const std::string& identifier, const std::vector<uint8_t>& values)
+		{
+			if(values.empty())
+			{
+				return "nullptr";
+			}
+
+			mOut << "\tconstexpr uint8_t " << identifier << "[] = {";
+
+			for(size_t i = 0; i < values.size(); ++i)
+			{
+				mOut << (i % NUMBERS_PER_LINE == 0 ? "\n\t\t" : " ") << static_cast<int>(values[i]) << ",";
+			}
+
+			mOut << "\n\t};\n\n";
+
+			return identifier;
+		}
+
+		//numRows rows of rowLength chars, one row per line
+		std::string Rows(const std::string& identifier, const std::vector<char>& rows, size_t rowLength)
+		{
+			if(rows.empty() || rowLength == 0)
+			{
+				return "nullptr";
+			}
+
+			mOut << "\tconstexpr char " << identifier << "[] =\n";
+
+			for(size_t offset = 0; offset < rows.size(); offset += rowLength)
+			{
+				mOut << "\t\t" << StringLiteral(rows.data() + offset, rowLength) << "\n";
+			}
+
+			mOut << "\t\t;\n\n";
+
+			return identifier;
+		}
+
+		bool Image(const PackEntry& entry, std::string& table)
+		{
+			PayloadReader reader(entry.payload);
+			PackedImage image = reader.Read<PackedImage>();
+			size_t numPixels = static_cast<size_t>(image.width) * image.height;
+			const std::string id = Identifier(entry.name);
+
+			std::string palette = "nullptr";
+			std::string indices = "nullptr";
+			std::string pixels = "nullptr";
+
+			if(image.paletteSize > 0)
+			{
+				std::vector<PackedColor> paletteColors = reader.ReadArray<PackedColor>(image.paletteSize);
+				std::vector<uint8_t> indexValues = reader.ReadArray<uint8_t>(numPixels);
+
+				if(!reader.IsValid())
+				{
+					return false;
+				}
+
+				palette = Array(id + "_palette", "PackedColor", paletteColors);
+				indices = Bytes(id + "_indices", indexValues);
+			}
+			else
+			{
+				std::vector<PackedColor> pixelColors = reader.ReadArray<PackedColor>(numPixels);
+
+				if(!reader.IsValid())
+				{
+					return false;
+				}
+
+				pixels = Array(id + "_pixels", "PackedColor", pixelColors);
+			}
+
+			table = "{{" + std::to_string(image.width) + ", " + std::to_string(image.height) + ", " + std::to_string(image.paletteSize) + ", 0}, " +
+					palette + ", " + indices + ", " + pixels + "}";
+			return true;
+		}
+
+		bool SpriteSections(const PackEntry& entry, std::string& table)
+		{
+			PayloadReader reader(entry.payload);
+			std::vector<PackedSpriteSection> sections = reader.ReadArray<PackedSpriteSection>(entry.payload.size() / sizeof(PackedSpriteSection));
+
+			table = "{" + Array(Identifier(entry.name) + "_sections", "PackedSpriteSection", sections) + ", " + std::to_string(sections.size()) + "}";
+			return reader.IsValid();
+		}
+
+		bool Animations(const PackEntry& entry, std::string& table)
+		{
+			PayloadReader reader(entry.payload);
+			PackedAnimationsHeader header = reader.Read<PackedAnimationsHeader>();
+			std::vector<PackedAnimation> animations = reader.ReadArray<PackedAnimation>(header.numAnimations);
+			std::vector<PackedName> frameKeys = reader.ReadArray<PackedName>(header.numFrameKeys);
+			std::vector<PackedColor> colors = reader.ReadArray<PackedColor>(header.numColors);
+			std::vector<PackedVec2D> offsets = reader.ReadArray<PackedVec2D>(header.numOffsets);
+
+			if(!reader.IsValid())
+			{
+				return false;
+			}
+
+			const std::string id = Identifier(entry.name);
+
+			table = "{{" + std::to_string(header.numAnimations) + ", " + std::to_string(header.numFrameKeys) + ", " +
+					std::to_string(header.numColors) + ", " + std::to_string(header.numOffsets) + "}, " +
+					Array(id + "_animations", "PackedAnimation", animations) + ", " +
+					Array(id + "_frameKeys", "PackedName", frameKeys) + ", " +
+					Array(id + "_colors", "PackedColor", colors) + ", " +
+					Array(id + "_offsets", "PackedVec2D", offsets) + "}";
+			return true;
+		}
+
+		bool PacmanLevel(const PackEntry& entry, std::string& table)
+		{
+			PayloadReader reader(entry.payload);
+			PackedPacmanLevelHeader header = reader.Read<PackedPacmanLevelHeader>();
+			std::vector<PackedPacmanTile> tiles = reader.ReadArray<PackedPacmanTile>(header.numTiles);
+			std::vector<PackedBonusItem> bonusItems = reader.ReadArray<PackedBonusItem>(header.numBonusItems);
+			std::vector<char> layout = reader.ReadArray<char>(static_cast<size_t>(header.numLayoutRows) * header.layoutRowLength);
+
+			if(!reader.IsValid())
+			{
+				return false;
+			}
+
+			const std::string id = Identifier(entry.name);
+
+			std::ostringstream headerStream;
+			headerStream << "{" << FieldLiteral(header.bgImage) << ", " << ToString(header.layoutOffset) << ", " << header.tileHeight << ", "
+						 << header.numTiles << ", " << header.numBonusItems << ", " << header.numLayoutRows << ", " << header.layoutRowLength << ", 0}";
+
+			table = "{" + headerStream.str() + ", " +
+					Array(id + "_tiles", "PackedPacmanTile", tiles) + ", " +
+					Array(id + "_bonusItems", "PackedBonusItem", bonusItems) + ", " +
+					Rows(id + "_layout", layout, header.layoutRowLength) + "}";
+			return true;
+		}
+
+		bool BreakoutLevels(const PackEntry& entry, std::string& table)
+		{
+			PayloadReader reader(entry.payload);
+			PackedBreakoutLevelsHeader header = reader.Read<PackedBreakoutLevelsHeader>();
+			std::vector<PackedBreakoutLevel> levels = reader.ReadArray<PackedBreakoutLevel>(header.numLevels);
+			std::vector<PackedBreakoutBlockType> blockTypes = reader.ReadArray<PackedBreakoutBlockType>(header.numBlockTypes);
+			std::vector<char> rows = reader.ReadArray<char>(static_cast<size_t>(header.numRows) * header.rowLength);
+
+			if(!reader.IsValid())
+			{
+				return false;
+			}
+
+			const std::string id = Identifier(entry.name);
+
+			table = "{{" + std::to_string(header.numLevels) + ", " + std::to_string(header.numBlockTypes) + ", " +
+					std::to_string(header.numRows) + ", " + std::to_string(header.rowLength) + "}, " +
+					Array(id + "_levels", "PackedBreakoutLevel", levels) + ", " +
+					Array(id + "_blockTypes", "PackedBreakoutBlockType", blockTypes) + ", " +
+					Rows(id + "_rows", rows, header.rowLength) + "}";
+			return true;
+		}
+
+	private:
+		std::ostream& mOut;
+	};
+
+	struct NamedTables
+	{
+		const char* tableType;
+		const char* identifier;
+		std::vector<std::pair<std::string, std::string>> tables; //asset name, table initializer
+	};
+}
+
+bool WriteEmbeddedTables(const std::string& path, const std::vector<PackEntry>& packEntries, bool embedImages)
+{
+	std::ostringstream arrays;
+	TablesWriter writer(arrays);
+
+	//In the order of EmbeddedAssetTables' members
+	NamedTables namedTables[] = {
+		{"ImageTable", "IMAGES", {}},
+		{"SpriteSectionsTable", "SPRITE_SECTIONS", {}},
+		{"AnimationsTable", "ANIMATIONS", {}},
+		{"PacmanLevelTable", "PACMAN_LEVELS", {}},
+		{"BreakoutLevelsTable", "BREAKOUT_LEVELS", {}},
+	};
+
+	for(const PackEntry& entry : packEntries)
+	{
+		std::string table;
+		bool written = true;
+		size_t tablesIndex = 0;
+
+		switch(entry.type)
+		{
+			case ASSET_PACK_IMAGE:
+				if(!embedImages)
+				{
+					continue;
+				}
+
+				written = writer.Image(entry, table);
+				tablesIndex = 0;
+			break;
+
+			case ASSET_PACK_SPRITE_SECTIONS:
+				written = writer.SpriteSections(entry, table);
+				tablesIndex = 1;
+			break;
+
+			case ASSET_PACK_ANIMATIONS:
+				written = writer.Animations(entry, table);
+				tablesIndex = 2;
+			break;
+
+			case ASSET_PACK_PACMAN_LEVEL:
+				written = writer.PacmanLevel(entry, table);
+				tablesIndex = 3;
+			break;
+
+			case ASSET_PACK_BREAKOUT_LEVELS:
+				written = writer.BreakoutLevels(entry, table);
+				tablesIndex = 4;
+			break;
+		}
+
+		if(!written)
+		{
+			std::cout << entry.name << ": truncated payload, not embedded" << std::endl;
+			return false;
+		}
+
+		namedTables[tablesIndex].tables.emplace_back(entry.name, table);
+	}
+
+	std::error_code error;
+	std::filesystem::path outputPath = path;
+
+	if(outputPath.has_parent_path())
+	{
+		std::filesystem::create_directories(outputPath.parent_path(), error);
+	}
+
+	std::ofstream outFile(path);
+
+	if(!outFile.is_open())
+	{
+		std::cout << "Could not write the file: " << path << std::endl;
+		return false;
+	}
+
+	outFile << "//Generated by AssetPacker --embed, do not edit. Rerun it whenever one of the assets changes.\n"
+			<< "//Only compiled into builds with ARCADE_EMBEDDED_ASSETS, see Utils/AssetTables.h\n\n"
+			<< "#include \"AssetTables.h\"\n\n"
+			<< "namespace\n{\n"
+			<< arrays.str();
+
+	bool firstTables = true;
+
+	for(const NamedTables& named : namedTables)
+	{
+		if(named.tables.empty())
+		{
+			continue;
+		}
+
+		outFile << (firstTables ? "" : "\n") << "\tconstexpr NamedAssetTable<" << named.tableType << "> " << named.identifier << "[] = {\n";
+		firstTables = false;
+
+		for(const auto& nameAndTable : named.tables)
+		{
+			outFile << "\t\t{" << StringLiteral(nameAndTable.first.c_str(), nameAndTable.first.length()) << ", " << nameAndTable.second << "},\n";
+		}
+
+		outFile << "\t};\n";
+	}
+
+	outFile << "}\n\n"
+			<< "extern const EmbeddedAssetTables EMBEDDED_ASSET_TABLES = {\n";
+
+	for(size_t i = 0; i < sizeof(namedTables) / sizeof(namedTables[0]); ++i)
+	{
+		const NamedTables& named = namedTables[i];
+		const bool last = i + 1 == sizeof(namedTables) / sizeof(namedTables[0]);
+
+		if(named.tables.empty())
+		{
+			outFile << "\tnullptr, 0" << (last ? "\n" : ",\n");
+		}
+		else
+		{
+			outFile << "\t" << named.identifier << ", " << named.tables.size() << (last ? "\n" : ",\n");
+		}
+	}
+
+	outFile << "};\n";
+
+	return outFile.good();
+}
@@ -0,0 +1,56 @@
+//============================================================================
+// Name        : AtlasPacker.cpp
+// Description : Offline sprite atlas packer. Reads a sprite sheet pair
+//               (<name>.bmp + <name>.txt), trims every sprite down to its
+//               opaque pixels, packs the trimmed sprites into a new sheet and
+//               writes <name>Packed.bmp + <name>Packed.txt with the trim offsets
+//               to the output directory. A sheet that doesn't come out smaller
+//               is written there unchanged instead. The packing itself is in
+//               ArcadeApp/src/Utils/AtlasPacking.cpp, hot reload repacks with it.
+//
+// Usage       : AtlasPacker <assets directory> <output directory> <sheet name> [<sheet name> ...]
+//============================================================================
+
+#define SDL_MAIN_HANDLED
+#include <SDL2/SDL.h>
+#include <iostream>
+#include <stdint.h>
+#include "AtlasPacking.h"
+
+int main(int argc, char* argv[])
+{
+	if(argc < 4)
+	{
+		std::cout << "Usage: AtlasPacker <assets directory> <output directory> <sheet name> [<sheet name> ...]" << std::endl;
+		return 1;
+	}
+
+	int result = 0;
+
+	for(int i = 3; i < argc; ++i)
+	{
+		AtlasPackStats stats;
+
+		if(!PackAtlas(argv[1], argv[2], argv[i], stats))
+		{
+			std::cout << argv[i] << ": failed" << std::endl;
+			result = 1;
+			continue;
+		}
+
+		if(stats.keptSource)
+		{
+			std::cout << argv[i] << ": packing doesn't make the sheet smaller, kept the source (" << stats.sourceSheetPixels << " pixels)" << std::endl;
+			continue;
+		}
+
+		uint64_t savedSpritePixels = stats.sourceSpritePixels - stats.packedSpritePixels;
+		double savedPercent = stats.sourceSpritePixels > 0 ? 100.0 * savedSpritePixels / stats.sourceSpritePixels : 0.0;
+
+		std::cout << argv[i] << ": sprite pixels " << stats.sourceSpritePixels << " -> " << stats.packedSpritePixels
+			<< " (saved " << savedSpritePixels << ", " << savedPercent << "%)"
+			<< ", sheet pixels " << stats.sourceSheetPixels << " -> " << stats.packedSheetPixels << std::endl;
+	}
+
+	return result;
+}
@@ -0,0 +1,251 @@
+//============================================================================
+// Name        : ImageCompressor.cpp
+// Description : Offline image compressor. Writes a compressed .aimg (see
+//               Utils/ImageCodec.h) next to every bmp in the assets directory,
+//               BMPImage prefers it over the bmp. Reports the compression
+//               ratio and how fast the result decodes compared to BMPImage
+//               reading the bmp. Rerun this whenever one of the bmps changes.
+//
+// Usage       : ImageCompressor <assets directory> [<rows per chunk>]
+//============================================================================
+
+#define SDL_MAIN_HANDLED
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include "ImageCodec.h"
+#include "ThreadPool.h"
+#include "BMPFile.h"
+
+namespace
+{
+	const int NUM_TIMING_RUNS = 20;
+
+	using Clock = std::chrono::steady_clock;
+
+	//Top down RGBA, the same thing DecodeImage hands back
+	bool ReadBMP(const std::string& path, uint32_t& width, uint32_t& height, std::vector<uint8_t>& rgba)
+	{
+		SDL_Surface* loadedSurface = SDL_LoadBMP(path.c_str());
+
+		if(loadedSurface == nullptr)
+		{
+			std::cout << "Could not load the image: " << path << " - " << SDL_GetError() << std::endl;
+			return false;
+		}
+
+		SDL_Surface* surface = SDL_ConvertSurfaceFormat(loadedSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+		SDL_FreeSurface(loadedSurface);
+
+		if(surface == nullptr)
+		{
+			std::cout << "Could not convert the image: " << path << " - " << SDL_GetError() << std::endl;
+			return false;
+		}
+
+		width = surface->w;
+		height = surface->h;
+		rgba.resize(static_cast<size_t>(width) * height * 4);
+
+		SDL_LockSurface(surface);
+
+		for(uint32_t y = 0; y < height; ++y)
+		{
+			const uint32_t* row = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(surface->pixels) + y * surface->pitch);
+
+			for(uint32_t x = 0; x < width; ++x)
+			{
+				uint8_t* pixel = &rgba[(static_cast<size_t>(y) * width + x) * 4];
+				SDL_GetRGBA(row[x], surface->format, &pixel[0], &pixel[1], &pixel[2], &pixel[3]);
+			}
+		}
+
+		SDL_UnlockSurface(surface);
+		SDL_FreeSurface(surface);
+
+		return true;
+	}
+
+	bool ReadFile(const std::string& path, std::vector<uint8_t>& contents)
+	{
+		std::ifstream inFile(path, std::ios::binary | std::ios::ate);
+
+		if(!inFile.is_open())
+		{
+			return false;
+		}
+
+		contents.resize(static_cast<size_t>(inFile.tellg()));
+		inFile.seekg(0);
+
+		return static_cast<bool>(inFile.read(reinterpret_cast<char*>(contents.data()), contents.size()));
+	}
+
+	//Decodes the file's bytes into rgba, the way the game reads it
+	bool DecodeFile(const std::vector<uint8_t>& file, ThreadPool* noptrThreadPool, std::vector<uint8_t>& rgba)
+	{
+		CompressedImageView image;
+
+		if(!image.Open(file.data(), file.size()))
+		{
+			return false;
+		}
+
+		rgba.resize(static_cast<size_t>(image.Width()) * image.Height() * 4);
+		const size_t rowSize = static_cast<size_t>(image.Width()) * 4;
+
+		return DecodeImage(image, noptrThreadPool, [&rgba, rowSize](uint32_t firstRow, uint32_t numRows, const uint8_t* rows){
+			memcpy(&rgba[firstRow * rowSize], rows, numRows * rowSize);
+		});
+	}
+
+	//Megabytes of decoded pixels per second
+	template<class Func>
+	double Throughput(size_t decodedSize, Func func)
+	{
+		Clock::time_point start = Clock::now();
+
+		for(int i = 0; i < NUM_TIMING_RUNS; ++i)
+		{
+			func();
+		}
+
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+		return seconds > 0.0 ? (static_cast<double>(decodedSize) * NUM_TIMING_RUNS) / (seconds * 1024.0 * 1024.0) : 0.0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if(argc < 2)
+	{
+		std::cout << "Usage: ImageCompressor <assets directory> [<rows per chunk>]" << std::endl;
+		return 1;
+	}
+
+	const std::filesystem::path assetsDir = argv[1];
+	const uint32_t rowsPerChunk = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : COMPRESSED_IMAGE_DEFAULT_ROWS_PER_CHUNK;
+
+	if(rowsPerChunk == 0)
+	{
+		std::cout << "Rows per chunk has to be at least 1" << std::endl;
+		return 1;
+	}
+
+	std::vector<std::filesystem::path> bmpPaths;
+	std::error_code error;
+
+	for(const auto& dirEntry : std::filesystem::directory_iterator(assetsDir, error))
+	{
+		if(dirEntry.is_regular_file() && dirEntry.path().extension().string() == ".bmp")
+		{
+			bmpPaths.push_back(dirEntry.path());
+		}
+	}
+
+	if(error)
+	{
+		std::cout << "Could not read the directory: " << assetsDir.string() << " - " << error.message() << std::endl;
+		return 1;
+	}
+
+	std::sort(bmpPaths.begin(), bmpPaths.end());
+
+	//BMPImage's reader builds Colors, they need a pixel format to pack into
+	SDL_PixelFormat* format = SDL_AllocFormat(SDL_PIXELFORMAT_ARGB8888);
+	Color::InitColorFormat(format);
+
+	ThreadPool threadPool;
+	int result = 0;
+	uint64_t totalBMPSize = 0;
+	uint64_t totalCompressedSize = 0;
+
+	std::cout << std::fixed << std::setprecision(1);
+
+	for(const std::filesystem::path& bmpPath : bmpPaths)
+	{
+		const std::string name = bmpPath.filename().string();
+		uint32_t width = 0;
+		uint32_t height = 0;
+		std::vector<uint8_t> rgba;
+
+		if(!ReadBMP(bmpPath.string(), width, height, rgba))
+		{
+			result = 1;
+			continue;
+		}
+
+		std::vector<uint8_t> compressed = EncodeImage(rgba.data(), width, height, rowsPerChunk);
+		std::vector<uint8_t> decoded;
+
+		//Never write a file the game would read back differently
+		if(!DecodeFile(compressed, nullptr, decoded) || decoded != rgba)
+		{
+			std::cout << name << ": the image doesn't survive a round trip, skipped" << std::endl;
+			result = 1;
+			continue;
+		}
+
+		std::filesystem::path outputPath = bmpPath;
+		outputPath.replace_extension(COMPRESSED_IMAGE_EXTENSION);
+
+		std::ofstream outFile(outputPath, std::ios::binary);
+		outFile.write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+
+		if(!outFile.good())
+		{
+			std::cout << "Could not write the file: " << outputPath.string() << std::endl;
+			result = 1;
+			continue;
+		}
+
+		outFile.close();
+
+		const uint64_t bmpSize = std::filesystem::file_size(bmpPath, error);
+		totalBMPSize += bmpSize;
+		totalCompressedSize += compressed.size();
+
+		//Both sides include reading the file so the bmp's extra bytes on disk count against it. The baseline is
+		//the reader BMPImage loads the bmp with - it only falls back to SDL for the files that reader can't do
+		std::vector<uint8_t> file;
+		std::vector<Color> bmpPixels;
+		std::vector<uint8_t> bmpIndices;
+		Palette bmpPalette;
+		uint32_t bmpWidth = 0;
+		uint32_t bmpHeight = 0;
+		std::vector<uint8_t> sdlPixels;
+
+		const bool nativeBMP = ReadBMPFile(bmpPath.string(), bmpWidth, bmpHeight, bmpPixels, bmpIndices, bmpPalette);
+
+		double bmpSpeed = nativeBMP ?
+			Throughput(rgba.size(), [&]{ ReadBMPFile(bmpPath.string(), bmpWidth, bmpHeight, bmpPixels, bmpIndices, bmpPalette); }) :
+			Throughput(rgba.size(), [&]{ ReadBMP(bmpPath.string(), bmpWidth, bmpHeight, sdlPixels); });
+		double singleSpeed = Throughput(rgba.size(), [&]{ ReadFile(outputPath.string(), file) && DecodeFile(file, nullptr, decoded); });
+		double pooledSpeed = Throughput(rgba.size(), [&]{ ReadFile(outputPath.string(), file) && DecodeFile(file, &threadPool, decoded); });
+
+		std::cout << name << ": " << bmpSize << " -> " << compressed.size() << " bytes ("
+				  << (compressed.empty() ? 0.0 : static_cast<double>(bmpSize) / compressed.size()) << ":1), "
+				  << (nativeBMP ? "bmp " : "bmp (SDL) ") << bmpSpeed << " MB/s, decode " << singleSpeed << " MB/s, "
+				  << threadPool.NumThreads() + 1 << " threads " << pooledSpeed << " MB/s" << std::endl;
+	}
+
+	if(totalCompressedSize > 0)
+	{
+		std::cout << "Total: " << totalBMPSize << " -> " << totalCompressedSize << " bytes ("
+				  << static_cast<double>(totalBMPSize) / totalCompressedSize << ":1)" << std::endl;
+	}
+
+	SDL_FreeFormat(format);
+
+	return result;
+}
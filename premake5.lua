@@ -12,6 +12,30 @@ workspace "ArcadeApp"
 
 outputdir = "%{cfg.buildcfg}_%{cfg.system}_%{cfg.architecture}"
 
+newoption
+{
+	trigger = "embed-assets",
+	value = "WHAT",
+	description = "Compile the assets into ArcadeApp as constexpr tables (see Tools/AssetPacker --embed)",
+	allowed =
+	{
+		{ "tables", "Sprite sections, animations and levels - the images are still read from disk" },
+		{ "all", "Everything, images included" },
+	}
+}
+
+newoption
+{
+	trigger = "profiler",
+	description = "Build in the frame profiler (see Utils/Profiler.h), its overlay is toggled with the ` key",
+}
+
+newoption
+{
+	trigger = "track-allocations",
+	description = "Count every heap allocation per frame and per profiler zone (replaces operator new), implies --profiler",
+}
+
 includeDirs = {}
 
 
@@ -38,6 +62,9 @@ project "ArcadeApp"
 		"%{prj.name}/src/**",
 	}
 
+	-- The games load the packed sheets, see the postbuild step at the end of the filters
+	dependson { "AtlasPacker" }
+
 	filter "system:windows"
 		systemversion "latest"
 		disablewarnings { "26812", "26495" }
@@ -102,7 +129,8 @@ project "ArcadeApp"
 	filter {"action:gmake2", "system:linux"}
 		links
 		{
-			"SDL2"	
+			"SDL2",
+			"pthread"
 		}
 		
 		postbuildcommands
@@ -111,7 +139,32 @@ project "ArcadeApp"
 			"{COPY} ./assets" .. " ../" .. output_dir_root
 		}
 		
+	-- After the assets are copied - <name>Packed.bmp/.txt are built from <name>.bmp/.txt straight into the output
+	filter {}
+		postbuildcommands
+		{
+			"\"%{wks.location}/bin/" .. outputdir .. "/AtlasPacker/AtlasPacker\" ./assets ../" .. output_dir_root .. "/assets AsteroidsSprites PacmanSprites"
+		}
+
+	filter "options:embed-assets"
+		defines { "ARCADE_EMBEDDED_ASSETS" }
+		dependson { "AssetPacker" }
+		files { "%{prj.name}/generated/EmbeddedAssetTables.cpp" }
+
+	filter "options:profiler"
+		defines { "ARCADE_PROFILER" }
+
+	filter "options:track-allocations"
+		defines { "ARCADE_PROFILER", "ARCADE_TRACK_ALLOCATIONS" }
+
+	filter {"options:track-allocations", "system:linux or macosx"}
+		linkoptions { "-rdynamic" } -- function names in the sampled call stacks
+
+	filter "options:embed-assets=tables"
+		prebuildcommands { "\"%{wks.location}/bin/" .. outputdir .. "/AssetPacker/AssetPacker\" ./assets --embed ./generated/EmbeddedAssetTables.cpp" }
 
+	filter "options:embed-assets=all"
+		prebuildcommands { "\"%{wks.location}/bin/" .. outputdir .. "/AssetPacker/AssetPacker\" ./assets --embed ./generated/EmbeddedAssetTables.cpp --embed-images" }
 
 	filter "configurations:Debug"
 		defines  {"DEBUG"}
@@ -126,3 +179,169 @@ project "ArcadeApp"
 		symbols "Off"
 		optimize "On"
 		staticruntime "off"
+
+
+
+project "AtlasPacker"
+	location "Tools/AtlasPacker"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin_int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"Tools/%{prj.name}/src/**.h",
+		"Tools/%{prj.name}/src/**.cpp",
+		"ArcadeApp/src/Utils/AtlasPacking.cpp",
+		"ArcadeApp/src/Utils/FileCommandLoader.cpp",
+		"ArcadeApp/src/Utils/Utils.cpp",
+		"ArcadeApp/src/Utils/Vec2D.cpp",
+		"ArcadeApp/src/Utils/Easings.cpp",
+		"ArcadeApp/src/Graphics/Color.cpp",
+	}
+
+	includedirs
+	{
+		"Tools/%{prj.name}/src",
+		"ArcadeApp/src/**",
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+		libdirs { "ArcadeApp/lib/SDL2/Windows/lib/x64" }
+		includedirs { "ArcadeApp/lib/SDL2/Windows/include" }
+		links { "SDL2" }
+		postbuildcommands { "{COPY} ../../ArcadeApp/lib/SDL2/Windows/lib/x64/SDL2.dll ../../bin/" .. outputdir .. "/%{prj.name}" }
+
+	filter "system:macosx"
+		systemversion "10.13"
+		buildoptions { "-F ../../ArcadeApp/lib/SDL2/MacOSX/" }
+		linkoptions { "-F ../../ArcadeApp/lib/SDL2/MacOSX/" }
+		links { "SDL2.framework" }
+
+	filter {"action:gmake2", "system:linux"}
+		links { "SDL2" }
+
+	filter "configurations:Debug"
+		defines  {"DEBUG"}
+		runtime "Debug"
+		symbols "On"
+		optimize "Off"
+
+	filter "configurations:Release"
+		defines {"RELEASE"}
+		runtime "Release"
+		symbols "Off"
+		optimize "On"
+
+
+project "AssetPacker"
+	location "Tools/AssetPacker"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin_int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"Tools/%{prj.name}/src/**.h",
+		"Tools/%{prj.name}/src/**.cpp",
+		"ArcadeApp/src/Utils/FileCommandLoader.cpp",
+		"ArcadeApp/src/Utils/Utils.cpp",
+		"ArcadeApp/src/Utils/Vec2D.cpp",
+		"ArcadeApp/src/Utils/Easings.cpp",
+		"ArcadeApp/src/Graphics/Color.cpp",
+	}
+
+	includedirs
+	{
+		"Tools/%{prj.name}/src",
+		"ArcadeApp/src/**",
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+		libdirs { "ArcadeApp/lib/SDL2/Windows/lib/x64" }
+		includedirs { "ArcadeApp/lib/SDL2/Windows/include" }
+		links { "SDL2" }
+		postbuildcommands { "{COPY} ../../ArcadeApp/lib/SDL2/Windows/lib/x64/SDL2.dll ../../bin/" .. outputdir .. "/%{prj.name}" }
+
+	filter "system:macosx"
+		systemversion "10.13"
+		buildoptions { "-F ../../ArcadeApp/lib/SDL2/MacOSX/" }
+		linkoptions { "-F ../../ArcadeApp/lib/SDL2/MacOSX/" }
+		links { "SDL2.framework" }
+
+	filter {"action:gmake2", "system:linux"}
+		links { "SDL2" }
+
+	filter "configurations:Debug"
+		defines  {"DEBUG"}
+		runtime "Debug"
+		symbols "On"
+		optimize "Off"
+
+	filter "configurations:Release"
+		defines {"RELEASE"}
+		runtime "Release"
+		symbols "Off"
+		optimize "On"
+
+
+project "ImageCompressor"
+	location "Tools/ImageCompressor"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin_int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"Tools/%{prj.name}/src/**.h",
+		"Tools/%{prj.name}/src/**.cpp",
+		"ArcadeApp/src/Utils/ImageCodec.cpp",
+		"ArcadeApp/src/Utils/ThreadPool.cpp",
+		"ArcadeApp/src/Graphics/BMPFile.cpp",
+		"ArcadeApp/src/Graphics/Color.cpp",
+	}
+
+	includedirs
+	{
+		"Tools/%{prj.name}/src",
+		"ArcadeApp/src/**",
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+		libdirs { "ArcadeApp/lib/SDL2/Windows/lib/x64" }
+		includedirs { "ArcadeApp/lib/SDL2/Windows/include" }
+		links { "SDL2" }
+		postbuildcommands { "{COPY} ../../ArcadeApp/lib/SDL2/Windows/lib/x64/SDL2.dll ../../bin/" .. outputdir .. "/%{prj.name}" }
+
+	filter "system:macosx"
+		systemversion "10.13"
+		buildoptions { "-F ../../ArcadeApp/lib/SDL2/MacOSX/" }
+		linkoptions { "-F ../../ArcadeApp/lib/SDL2/MacOSX/" }
+		links { "SDL2.framework" }
+
+	filter {"action:gmake2", "system:linux"}
+		links { "SDL2", "pthread" }
+
+	filter "configurations:Debug"
+		defines  {"DEBUG"}
+		runtime "Debug"
+		symbols "On"
+		optimize "Off"
+
+	filter "configurations:Release"
+		defines {"RELEASE"}
+		runtime "Release"
+		symbols "Off"
+		optimize "On"